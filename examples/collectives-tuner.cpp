@@ -0,0 +1,305 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllgathervRing.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceAuto.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AlltoallvAuto.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/BroadcastBasicLinear.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/BroadcastBinomialTree.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/BroadcastPipelinedChain.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/BroadcastScatterAllgather.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/BroadcastSendToAll.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/Tuning.hpp>
+#include <GaspiCxx/group/Group.hpp>
+
+// Times all implemented algorithms of the Allreduce, Broadcast, Allgatherv
+// and Alltoallv collectives for a range of group sizes (the first ranks of the job) and
+// message sizes, and writes a tuning file selecting the fastest ones
+// (cf. `RuntimeConfiguration::set_tuning_file`).
+//
+// Usage: collectives-tuner [<tuning file> [<max message bytes> [<iterations>]]]
+namespace {
+
+  using namespace std::chrono;
+  using namespace gaspi::collectives;
+
+  using ElemType = float;
+
+  std::unique_ptr<CollectiveLowLevel> make_allreduce(AllreduceAlgorithm algorithm,
+                                                     gaspi::group::Group const& group,
+                                                     std::size_t number_elements)
+  {
+    switch (algorithm)
+    {
+      case AllreduceAlgorithm::RING:
+      {
+        return std::make_unique<AllreduceLowLevel<ElemType, AllreduceAlgorithm::RING>>(
+                 group, number_elements, ReductionOp::SUM);
+      }
+      case AllreduceAlgorithm::RECURSIVE_DOUBLING:
+      {
+        return std::make_unique<AllreduceLowLevel<ElemType, AllreduceAlgorithm::RECURSIVE_DOUBLING>>(
+                 group, number_elements, ReductionOp::SUM);
+      }
+      case AllreduceAlgorithm::RABENSEIFNER:
+      {
+        return std::make_unique<AllreduceLowLevel<ElemType, AllreduceAlgorithm::RABENSEIFNER>>(
+                 group, number_elements, ReductionOp::SUM);
+      }
+      case AllreduceAlgorithm::HIERARCHICAL:
+      {
+        return std::make_unique<AllreduceLowLevel<ElemType, AllreduceAlgorithm::HIERARCHICAL>>(
+                 group, number_elements, ReductionOp::SUM);
+      }
+      default:
+      { return nullptr; }
+    }
+  }
+
+  std::unique_ptr<CollectiveLowLevel> make_broadcast(BroadcastAlgorithm algorithm,
+                                                     gaspi::group::Group const& group,
+                                                     std::size_t number_elements)
+  {
+    gaspi::group::Rank const root(0);
+    switch (algorithm)
+    {
+      case BroadcastAlgorithm::BASIC_LINEAR:
+      {
+        return std::make_unique<BroadcastLowLevel<ElemType, BroadcastAlgorithm::BASIC_LINEAR>>(
+                 group, number_elements, root);
+      }
+      case BroadcastAlgorithm::SEND_TO_ALL:
+      {
+        return std::make_unique<BroadcastLowLevel<ElemType, BroadcastAlgorithm::SEND_TO_ALL>>(
+                 group, number_elements, root);
+      }
+      case BroadcastAlgorithm::BINOMIAL_TREE:
+      {
+        return std::make_unique<BroadcastLowLevel<ElemType, BroadcastAlgorithm::BINOMIAL_TREE>>(
+                 group, number_elements, root);
+      }
+      case BroadcastAlgorithm::PIPELINED_CHAIN:
+      {
+        return std::make_unique<BroadcastLowLevel<ElemType, BroadcastAlgorithm::PIPELINED_CHAIN>>(
+                 group, number_elements, root);
+      }
+      case BroadcastAlgorithm::SCATTER_ALLGATHER:
+      {
+        return std::make_unique<BroadcastLowLevel<ElemType, BroadcastAlgorithm::SCATTER_ALLGATHER>>(
+                 group, number_elements, root);
+      }
+      default:
+      { return nullptr; }
+    }
+  }
+
+  // the message size of an Allgatherv is the size of the gathered data,
+  // distributed (almost) evenly across the ranks
+  std::unique_ptr<CollectiveLowLevel> make_allgatherv(AllgathervAlgorithm algorithm,
+                                                      gaspi::group::Group const& group,
+                                                      std::size_t number_elements)
+  {
+    std::vector<std::size_t> counts(group.size(), number_elements / group.size());
+    for (auto i = 0UL; i < number_elements % group.size(); ++i)
+    {
+      ++counts[i];
+    }
+
+    switch (algorithm)
+    {
+      case AllgathervAlgorithm::RING:
+      {
+        return std::make_unique<AllgathervLowLevel<ElemType, AllgathervAlgorithm::RING>>(
+                 group, counts);
+      }
+      default:
+      { return nullptr; }
+    }
+  }
+
+  // the message size of an Alltoallv is the size of the data sent by each
+  // rank, distributed (almost) evenly across the ranks
+  std::unique_ptr<CollectiveLowLevel> make_alltoallv(AlltoallvAlgorithm algorithm,
+                                                     gaspi::group::Group const& group,
+                                                     std::size_t number_elements)
+  {
+    std::vector<std::size_t> send_counts(group.size(), number_elements / group.size());
+    for (auto i = 0UL; i < number_elements % group.size(); ++i)
+    {
+      ++send_counts[i];
+    }
+    std::vector<std::size_t> const recv_counts(group.size(), send_counts[group.rank().get()]);
+
+    switch (algorithm)
+    {
+      case AlltoallvAlgorithm::PAIRWISE_EXCHANGE:
+      {
+        return std::make_unique<AlltoallvLowLevel<ElemType, AlltoallvAlgorithm::PAIRWISE_EXCHANGE>>(
+                 group, send_counts, recv_counts);
+      }
+      case AlltoallvAlgorithm::BRUCK:
+      {
+        return std::make_unique<AlltoallvLowLevel<ElemType, AlltoallvAlgorithm::BRUCK>>(
+                 group, send_counts, recv_counts);
+      }
+      default:
+      { return nullptr; }
+    }
+  }
+
+  // average time (in seconds) of running the collective, including
+  // copying the data in and out
+  double time_collective(CollectiveLowLevel& collective,
+                         std::size_t number_elements,
+                         std::size_t iterations)
+  {
+    std::vector<ElemType> inputs(number_elements, ElemType(1));
+    std::vector<ElemType> outputs(std::max(collective.getOutputCount(), number_elements));
+
+    auto const run = [&]()
+      {
+        collective.copyIn(inputs.data());
+        collective.start();
+        collective.waitForCompletion();
+        collective.copyOut(outputs.data());
+      };
+
+    collective.waitForSetup();
+    run(); // warm-up
+    auto const start = high_resolution_clock::now();
+    for (auto i = 0UL; i < iterations; ++i)
+    {
+      run();
+    }
+    auto const end = high_resolution_clock::now();
+    return duration_cast<duration<double>>(end - start).count()
+           / static_cast<double>(iterations);
+  }
+
+  // Tunes one collective given by the `names` of its implemented algorithms,
+  // skipping those that cannot be created (e.g., AUTO)
+  template<typename Info, typename Factory>
+  SelectionTable tune_collective(std::string const& collective_name,
+                                 Factory&& make_collective,
+                                 std::vector<std::size_t> const& group_sizes,
+                                 std::vector<std::size_t> const& message_sizes,
+                                 std::size_t iterations)
+  {
+    auto& runtime = gaspi::getRuntime();
+    std::vector<TuningMeasurement> measurements;
+
+    for (auto const group_size : group_sizes)
+    {
+      std::vector<gaspi::group::GlobalRank> ranks(group_size);
+      std::iota(ranks.begin(), ranks.end(), 0);
+      auto const is_member = runtime.global_rank() < group_size;
+
+      std::vector<TuningMeasurement> group_measurements;
+      std::vector<double> times;
+      for (auto const message_bytes : message_sizes)
+      {
+        for (auto const algorithm : Info::implemented)
+        {
+          runtime.barrier();
+          if (!is_member) { continue; }
+
+          gaspi::group::Group const group(ranks);
+          auto const number_elements = message_bytes / sizeof(ElemType);
+          auto collective = make_collective(algorithm, group, number_elements);
+          if (collective == nullptr) { continue; }
+
+          times.push_back(time_collective(*collective, number_elements, iterations));
+          group_measurements.push_back({group_size, message_bytes,
+                                        Info::names[algorithm], 0.0});
+        }
+      }
+
+      if (is_member)
+      {
+        // a run takes as long as its slowest rank
+        gaspi::group::Group const group(ranks);
+        AllreduceLowLevel<double, AllreduceAlgorithm::RING> max_time(
+          group, times.size(), ReductionOp::MAX);
+        max_time.waitForSetup();
+        max_time.copyIn(times.data());
+        max_time.start();
+        max_time.waitForCompletion();
+        max_time.copyOut(times.data());
+
+        for (auto i = 0UL; i < times.size(); ++i)
+        {
+          group_measurements[i].time = times[i];
+          if (runtime.global_rank() == 0)
+          {
+            std::cout << collective_name << " ranks " << group_size
+                      << " bytes " << group_measurements[i].message_bytes
+                      << " " << group_measurements[i].algorithm
+                      << " " << times[i] * 1e6 << " us" << std::endl;
+          }
+        }
+        measurements.insert(measurements.end(),
+                            group_measurements.begin(), group_measurements.end());
+      }
+      runtime.barrier();
+    }
+    return build_selection_table(measurements);
+  }
+}
+
+int
+main
+  ( int argc
+  , char *argv[]) try {
+
+  std::string const tuning_file = argc > 1 ? argv[1] : "gaspicxx-tuning.txt";
+  std::size_t const max_message_bytes = argc > 2 ? std::stoul(argv[2]) : 4UL * 1024UL * 1024UL;
+  std::size_t const iterations = argc > 3 ? std::stoul(argv[3]) : 20UL;
+
+  gaspi::initGaspiCxx();
+  auto& runtime = gaspi::getRuntime();
+
+  // powers of two, and the whole job
+  std::vector<std::size_t> group_sizes;
+  for (auto group_size = 2UL; group_size < runtime.size(); group_size *= 2)
+  {
+    group_sizes.push_back(group_size);
+  }
+  group_sizes.push_back(runtime.size());
+
+  std::vector<std::size_t> message_sizes;
+  for (auto message_bytes = 4 * sizeof(ElemType); message_bytes <= max_message_bytes;
+       message_bytes *= 4)
+  {
+    message_sizes.push_back(message_bytes);
+  }
+
+  TuningTables tables;
+  tables["allreduce"] = tune_collective<AllreduceInfo>(
+                          "allreduce", make_allreduce, group_sizes, message_sizes, iterations);
+  tables["broadcast"] = tune_collective<BroadcastInfo>(
+                          "broadcast", make_broadcast, group_sizes, message_sizes, iterations);
+  tables["allgatherv"] = tune_collective<AllgathervInfo>(
+                           "allgatherv", make_allgatherv, group_sizes, message_sizes, iterations);
+  tables["alltoallv"] = tune_collective<AlltoallvInfo>(
+                          "alltoallv", make_alltoallv, group_sizes, message_sizes, iterations);
+
+  if (runtime.global_rank() == 0)
+  {
+    write_tuning_file(tuning_file, tables);
+    std::cout << "Tuning file written to " << tuning_file << std::endl;
+  }
+  runtime.barrier();
+
+  return EXIT_SUCCESS;
+} catch(std::exception const& e) {
+  std::cerr << e.what() << std::endl;
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/ReductionKernels.hpp>
+
+// Measures the per-byte cost of reducing one ring step (i.e., one block of
+// `number_elements/number_ranks` elements), comparing the reduction kernels
+// against an element-wise reduction through `std::function`.
+namespace {
+
+  using namespace std::chrono;
+  namespace reduction = gaspi::collectives::reduction;
+
+  std::size_t const bytes_per_measurement = 256UL * 1024UL * 1024UL;
+
+  template<typename Function>
+  double measure_ns_per_byte(std::size_t size_bytes, Function&& reduce)
+  {
+    auto const repetitions = std::max(bytes_per_measurement / size_bytes, 1UL);
+
+    reduce(); // warm-up
+    auto const start = high_resolution_clock::now();
+    for (auto i = 0UL; i < repetitions; ++i)
+    {
+      reduce();
+    }
+    auto const end = high_resolution_clock::now();
+
+    return duration_cast<duration<double, std::nano>>(end - start).count()
+           / static_cast<double>(repetitions * size_bytes);
+  }
+
+  template<typename T>
+  void run_benchmark(std::string const& type_name)
+  {
+    for (auto size_bytes = 4UL * 1024UL; size_bytes <= 64UL * 1024UL * 1024UL;
+         size_bytes *= 4)
+    {
+      auto const number_elements = size_bytes / sizeof(T);
+      std::vector<T> inouts(number_elements, T(1));
+      std::vector<T> inputs(number_elements, T(0));
+
+      auto const kernel_time = measure_ns_per_byte(size_bytes, [&]()
+        {
+          reduction::reduce<T, reduction::Sum>(inouts.data(), inputs.data(),
+                                               number_elements);
+        });
+
+      std::function<T(T const&, T const&)> reduction_functor = std::plus<T>();
+      auto const functor_time = measure_ns_per_byte(size_bytes, [&]()
+        {
+          std::transform(inouts.begin(), inouts.end(), inputs.begin(),
+                         inouts.begin(), reduction_functor);
+        });
+
+      std::cout << std::setw(8) << type_name
+                << std::setw(12) << size_bytes
+                << std::setw(16) << std::fixed << std::setprecision(4) << kernel_time
+                << std::setw(16) << functor_time
+                << std::setw(10) << std::setprecision(2) << functor_time / kernel_time
+                << std::endl;
+    }
+  }
+}
+
+int
+main
+  ( int /*argc*/
+  , char *[] /*argv*/) try {
+
+  std::cout << "SIMD width: " << reduction::simd_width_bytes << " bytes" << std::endl;
+  std::cout << std::setw(8) << "type"
+            << std::setw(12) << "bytes"
+            << std::setw(16) << "kernel ns/B"
+            << std::setw(16) << "functor ns/B"
+            << std::setw(10) << "speedup" << std::endl;
+
+  run_benchmark<float>("float");
+  run_benchmark<double>("double");
+  run_benchmark<std::int32_t>("int32");
+  run_benchmark<std::int64_t>("int64");
+  run_benchmark<std::int16_t>("int16");
+
+  return EXIT_SUCCESS;
+} catch(...) {
+  return EXIT_FAILURE;
+}
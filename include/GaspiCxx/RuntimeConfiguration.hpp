@@ -25,6 +25,8 @@
 #include <GaspiCxx/progress_engine/ProgressEngine.hpp>
 #include <GaspiCxx/segment/SegmentPool.hpp>
 
+#include <string>
+
 namespace gaspi {
 
 enum class SegmentPoolType
@@ -60,10 +62,23 @@ class RuntimeConfiguration
     std::unique_ptr<progress_engine::ProgressEngine> get_progress_engine() const;
     std::unique_ptr<CommunicationContext> get_communication_context() const;
 
+    //! Rules for selecting the algorithm of `AllreduceAlgorithm::AUTO`
+    //! (cf. `collectives::parse_selection_table`), replacing the built-in ones
+    //! unless empty
+    void set_allreduce_selection(std::string const&);
+    std::string const& get_allreduce_selection() const;
+
+    //! Tuning file driving the algorithm selection
+    //! (cf. `collectives::read_tuning_file`), not used if empty
+    void set_tuning_file(std::string const&);
+    std::string const& get_tuning_file() const;
+
   private:
     SegmentPoolType segment_pool_type;
     ProgressEngineType progress_engine_type;
     CommunicationContextType communication_context_type;
+    std::string allreduce_selection;
+    std::string tuning_file;
 
 };
 
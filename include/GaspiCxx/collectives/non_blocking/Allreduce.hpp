@@ -25,6 +25,10 @@
 #include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceCommon.hpp>
 #include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceRing.hpp>
 #include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceRecursiveDoubling.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceRabenseifner.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceHierarchical.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceCompressedRing.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceAuto.hpp>
 #include <GaspiCxx/progress_engine/ProgressEngine.hpp>
 #include <GaspiCxx/Runtime.hpp>
 
@@ -42,11 +46,11 @@ namespace gaspi
       public:
         Allreduce(gaspi::group::Group const& group,
                   std::size_t number_elements,
-                  ReductionOp reduction_op,
+                  ReductionKernel<T> reduction_kernel,
                   progress_engine::ProgressEngine& progress_engine);
         Allreduce(gaspi::group::Group const& group,
                   std::size_t number_elements,
-                  ReductionOp reduction_op);
+                  ReductionKernel<T> reduction_kernel);
         ~Allreduce();
 
         void start(void const* inputs) override;
@@ -57,6 +61,11 @@ namespace gaspi
 
         std::size_t getOutputCount() override;
 
+        // Segment memory to operate on in place, i.e., passing it
+        // to `start` and `waitForCompletion` avoids copying the data
+        // (cf. `AllreduceCommon::getInPlaceBuffer`)
+        T* getInPlaceBuffer();
+
       private:
         progress_engine::ProgressEngine& progress_engine;
         progress_engine::ProgressEngine::CollectiveHandle handle;
@@ -67,12 +76,12 @@ namespace gaspi
     Allreduce<T, Algorithm>::Allreduce(
       gaspi::group::Group const& group,
       std::size_t number_elements,
-      ReductionOp reduction_op,
+      ReductionKernel<T> reduction_kernel,
       progress_engine::ProgressEngine& progress_engine)
     : progress_engine(progress_engine),
       handle(),
       allreduce_impl(std::make_shared<AllreduceLowLevel<T, Algorithm>>(
-                     group, number_elements, reduction_op))
+                     group, number_elements, reduction_kernel))
     {
       allreduce_impl->waitForSetup();
       handle = progress_engine.register_collective(allreduce_impl);
@@ -82,8 +91,8 @@ namespace gaspi
     Allreduce<T, Algorithm>::Allreduce(
       gaspi::group::Group const& group,
       std::size_t number_elements,
-      ReductionOp reduction_op)
-    : Allreduce(group, number_elements, reduction_op,
+      ReductionKernel<T> reduction_kernel)
+    : Allreduce(group, number_elements, reduction_kernel,
                 gaspi::getRuntime().getDefaultProgressEngine())
     { }
 
@@ -124,5 +133,11 @@ namespace gaspi
     {
       return allreduce_impl->getOutputCount();
     }
+
+    template<typename T, AllreduceAlgorithm Algorithm>
+    T* Allreduce<T, Algorithm>::getInPlaceBuffer()
+    {
+      return static_cast<T*>(allreduce_impl->getInPlaceBuffer());
+    }
   }
 }
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Alltoallv.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/Collective.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AlltoallvAuto.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AlltoallvBruck.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AlltoallvCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AlltoallvPairwiseExchange.hpp>
+#include <GaspiCxx/progress_engine/ProgressEngine.hpp>
+#include <GaspiCxx/Runtime.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+
+    template<typename T, AlltoallvAlgorithm Algorithm>
+    class Alltoallv : public Collective
+    {
+      public:
+        Alltoallv(gaspi::group::Group const& group,
+                  std::vector<std::size_t> const& send_counts,
+                  std::vector<std::size_t> const& recv_counts,
+                  progress_engine::ProgressEngine& progress_engine);
+        Alltoallv(gaspi::group::Group const& group,
+                  std::vector<std::size_t> const& send_counts,
+                  std::vector<std::size_t> const& recv_counts);
+        // the received counts are exchanged at construction
+        Alltoallv(gaspi::group::Group const& group,
+                  std::vector<std::size_t> const& send_counts);
+        ~Alltoallv();
+
+        void start(void const* inputs) override;
+        void start(std::vector<T> const& inputs);
+
+        void waitForCompletion(void* outputs) override;
+        void waitForCompletion(std::vector<T>& outputs);
+
+        std::size_t getOutputCount() override;
+        std::vector<std::size_t> get_send_counts();
+        std::vector<std::size_t> get_recv_counts();
+
+      private:
+        progress_engine::ProgressEngine& progress_engine;
+        progress_engine::ProgressEngine::CollectiveHandle handle;
+        std::shared_ptr<AlltoallvLowLevel<T, Algorithm>> alltoallv_impl;
+        std::vector<std::size_t> send_counts;
+        std::vector<std::size_t> recv_counts;
+    };
+
+    // Each rank sends `count` elements to every rank
+    template<typename T, AlltoallvAlgorithm Algorithm>
+    class Alltoall : public Alltoallv<T, Algorithm>
+    {
+      public:
+        Alltoall(gaspi::group::Group const& group,
+                 std::size_t count,
+                 progress_engine::ProgressEngine& progress_engine);
+        Alltoall(gaspi::group::Group const& group,
+                 std::size_t count);
+    };
+
+    template<typename T, AlltoallvAlgorithm Algorithm>
+    Alltoallv<T, Algorithm>::Alltoallv(
+      gaspi::group::Group const& group,
+      std::vector<std::size_t> const& send_counts,
+      std::vector<std::size_t> const& recv_counts,
+      progress_engine::ProgressEngine& progress_engine)
+    : progress_engine(progress_engine),
+      handle(),
+      alltoallv_impl(std::make_shared<AlltoallvLowLevel<T, Algorithm>>(
+                     group, send_counts, recv_counts)),
+      send_counts(send_counts),
+      recv_counts(recv_counts)
+    {
+      alltoallv_impl->waitForSetup();
+      handle = progress_engine.register_collective(alltoallv_impl);
+    }
+
+    template<typename T, AlltoallvAlgorithm Algorithm>
+    Alltoallv<T, Algorithm>::Alltoallv(
+      gaspi::group::Group const& group,
+      std::vector<std::size_t> const& send_counts,
+      std::vector<std::size_t> const& recv_counts)
+    : Alltoallv(group, send_counts, recv_counts,
+                gaspi::getRuntime().getDefaultProgressEngine())
+    { }
+
+    template<typename T, AlltoallvAlgorithm Algorithm>
+    Alltoallv<T, Algorithm>::Alltoallv(
+      gaspi::group::Group const& group,
+      std::vector<std::size_t> const& send_counts)
+    : Alltoallv(group, send_counts, alltoall_counts(group, send_counts))
+    { }
+
+    template<typename T, AlltoallvAlgorithm Algorithm>
+    Alltoallv<T, Algorithm>::~Alltoallv()
+    {
+      progress_engine.deregister_collective(handle);
+    }
+
+    template<typename T, AlltoallvAlgorithm Algorithm>
+    void Alltoallv<T, Algorithm>::start(void const* inputs)
+    {
+      alltoallv_impl->copyIn(inputs);
+      alltoallv_impl->start();
+    }
+
+    template<typename T, AlltoallvAlgorithm Algorithm>
+    void Alltoallv<T, Algorithm>::start(std::vector<T> const& inputs)
+    {
+      start(static_cast<void const *>(inputs.data()));
+    }
+
+    template<typename T, AlltoallvAlgorithm Algorithm>
+    void Alltoallv<T, Algorithm>::waitForCompletion(void* outputs)
+    {
+      alltoallv_impl->waitForCompletion();
+      alltoallv_impl->copyOut(outputs);
+    }
+
+    template<typename T, AlltoallvAlgorithm Algorithm>
+    void Alltoallv<T, Algorithm>::waitForCompletion(std::vector<T>& outputs)
+    {
+      waitForCompletion(static_cast<void*>(outputs.data()));
+    }
+
+    template<typename T, AlltoallvAlgorithm Algorithm>
+    std::size_t Alltoallv<T, Algorithm>::getOutputCount()
+    {
+      return alltoallv_impl->getOutputCount();
+    }
+
+    template<typename T, AlltoallvAlgorithm Algorithm>
+    std::vector<std::size_t> Alltoallv<T, Algorithm>::get_send_counts()
+    {
+      return send_counts;
+    }
+
+    template<typename T, AlltoallvAlgorithm Algorithm>
+    std::vector<std::size_t> Alltoallv<T, Algorithm>::get_recv_counts()
+    {
+      return recv_counts;
+    }
+
+    template<typename T, AlltoallvAlgorithm Algorithm>
+    Alltoall<T, Algorithm>::Alltoall(
+      gaspi::group::Group const& group,
+      std::size_t count,
+      progress_engine::ProgressEngine& progress_engine)
+    : Alltoallv<T, Algorithm>(group, std::vector<std::size_t>(group.size(), count),
+                              std::vector<std::size_t>(group.size(), count),
+                              progress_engine)
+    { }
+
+    template<typename T, AlltoallvAlgorithm Algorithm>
+    Alltoall<T, Algorithm>::Alltoall(
+      gaspi::group::Group const& group,
+      std::size_t count)
+    : Alltoall(group, count, gaspi::getRuntime().getDefaultProgressEngine())
+    { }
+  }
+}
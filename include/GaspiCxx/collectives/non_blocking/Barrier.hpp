@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Barrier.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/BarrierCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/BarrierDissemination.hpp>
+#include <GaspiCxx/progress_engine/ProgressEngine.hpp>
+#include <GaspiCxx/Runtime.hpp>
+
+#include <memory>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+
+    //! Non-blocking (fuzzy) barrier, completed by a progress engine
+    //!
+    //! A rank may keep computing between `start` and the completion
+    //! of the barrier, which occurs once all ranks in the group have
+    //! called `start`.
+    template<BarrierAlgorithm Algorithm>
+    class Barrier
+    {
+      public:
+        Barrier(gaspi::group::Group const& group,
+                progress_engine::ProgressEngine& progress_engine);
+        Barrier(gaspi::group::Group const& group);
+        ~Barrier();
+
+        //! Enter the barrier
+        void start();
+
+        //! Non-blocking check whether all ranks have entered the barrier.
+        //! Returns `true` only once per run, after which the barrier
+        //! may be started again.
+        bool test();
+
+        //! Blocking wait until all ranks have entered the barrier
+        //! (returns immediately if `test` already succeeded)
+        void waitForCompletion();
+
+      private:
+        progress_engine::ProgressEngine& progress_engine;
+        progress_engine::ProgressEngine::CollectiveHandle handle;
+        std::shared_ptr<BarrierLowLevel<Algorithm>> barrier_impl;
+    };
+
+    template<BarrierAlgorithm Algorithm>
+    Barrier<Algorithm>::Barrier(
+      gaspi::group::Group const& group,
+      progress_engine::ProgressEngine& progress_engine)
+    : progress_engine(progress_engine),
+      handle(),
+      barrier_impl(std::make_shared<BarrierLowLevel<Algorithm>>(group))
+    {
+      barrier_impl->waitForSetup();
+      handle = progress_engine.register_collective(barrier_impl);
+    }
+
+    template<BarrierAlgorithm Algorithm>
+    Barrier<Algorithm>::Barrier(
+      gaspi::group::Group const& group)
+    : Barrier(group, gaspi::getRuntime().getDefaultProgressEngine())
+    { }
+
+    template<BarrierAlgorithm Algorithm>
+    Barrier<Algorithm>::~Barrier()
+    {
+      progress_engine.deregister_collective(handle);
+    }
+
+    template<BarrierAlgorithm Algorithm>
+    void Barrier<Algorithm>::start()
+    {
+      barrier_impl->copyIn(CollectiveLowLevel::NO_DATA);
+      barrier_impl->start();
+    }
+
+    template<BarrierAlgorithm Algorithm>
+    bool Barrier<Algorithm>::test()
+    {
+      if (!barrier_impl->checkForCompletion())
+      {
+        return false;
+      }
+      barrier_impl->copyOut(CollectiveLowLevel::NO_DATA);
+      return true;
+    }
+
+    template<BarrierAlgorithm Algorithm>
+    void Barrier<Algorithm>::waitForCompletion()
+    {
+      barrier_impl->waitForCompletion();
+      test();
+    }
+  }
+}
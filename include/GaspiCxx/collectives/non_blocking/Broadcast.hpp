@@ -27,6 +27,9 @@
 #include <GaspiCxx/Runtime.hpp>
 #include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/BroadcastSendToAll.hpp>
 #include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/BroadcastBasicLinear.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/BroadcastBinomialTree.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/BroadcastPipelinedChain.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/BroadcastScatterAllgather.hpp>
 
 #include <memory>
 #include <stdexcept>
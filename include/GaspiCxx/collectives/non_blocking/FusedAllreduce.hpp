@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * FusedAllreduce.hpp
+ *
+ */
+
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/Allreduce.hpp>
+#include <GaspiCxx/progress_engine/ProgressEngine.hpp>
+#include <GaspiCxx/Runtime.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    struct FusedAllreduceSettings
+    {
+      // Maximum size of the communication buffer of a bucket;
+      // larger tensors are reduced in a bucket of their own
+      static inline std::size_t bucket_size_bytes = 64 * 1024 * 1024;
+    };
+
+    // Allreduce over a fixed list of (typically small) tensors, which
+    // are packed into buckets of contiguous communication buffers,
+    // such that a single allreduce is executed per bucket.
+    //
+    // Each bucket is started as soon as its tensors have been packed,
+    // and its results are unpacked as soon as it has completed, so that
+    // the copies overlap with the communication of the other buckets.
+    template<typename T, AllreduceAlgorithm Algorithm>
+    class FusedAllreduce
+    {
+      public:
+        // (pointer, number of elements) of each tensor
+        using Input = std::pair<T const*, std::size_t>;
+        using Output = std::pair<T*, std::size_t>;
+
+        FusedAllreduce(gaspi::group::Group const& group,
+                       std::vector<std::size_t> const& tensor_counts,
+                       ReductionKernel<T> reduction_kernel,
+                       progress_engine::ProgressEngine& progress_engine,
+                       std::size_t bucket_size_bytes = FusedAllreduceSettings::bucket_size_bytes);
+        FusedAllreduce(gaspi::group::Group const& group,
+                       std::vector<std::size_t> const& tensor_counts,
+                       ReductionKernel<T> reduction_kernel,
+                       std::size_t bucket_size_bytes = FusedAllreduceSettings::bucket_size_bytes);
+        ~FusedAllreduce();
+
+        void start(std::vector<Input> const& inputs);
+        void waitForCompletion(std::vector<Output> const& outputs);
+
+        std::size_t getNumberBuckets() const;
+
+      private:
+        using Bucket = AllreduceLowLevel<T, Algorithm>;
+
+        // position of a tensor in the bucket buffers
+        struct Location
+        {
+          std::size_t bucket;
+          std::size_t offset;
+        };
+
+        progress_engine::ProgressEngine& progress_engine;
+        std::vector<std::size_t> tensor_counts;
+        std::vector<Location> locations;
+        // indices of the first tensor of each bucket (and the end of the last one)
+        std::vector<std::size_t> bucket_begins;
+        std::vector<std::shared_ptr<Bucket>> buckets;
+        std::vector<progress_engine::ProgressEngine::CollectiveHandle> handles;
+
+        template<typename Tensor>
+        void check_tensors(std::vector<Tensor> const& tensors) const;
+    };
+
+    template<typename T, AllreduceAlgorithm Algorithm>
+    FusedAllreduce<T, Algorithm>::FusedAllreduce(
+      gaspi::group::Group const& group,
+      std::vector<std::size_t> const& tensor_counts,
+      ReductionKernel<T> reduction_kernel,
+      progress_engine::ProgressEngine& progress_engine,
+      std::size_t bucket_size_bytes)
+    : progress_engine(progress_engine),
+      tensor_counts(tensor_counts),
+      locations(),
+      bucket_begins(),
+      buckets(),
+      handles()
+    {
+      auto const bucket_capacity = std::max(bucket_size_bytes / sizeof(T), 1UL);
+
+      // assign tensors in order, starting a new bucket when the next tensor
+      // does not fit into the current one anymore
+      std::vector<std::size_t> bucket_counts;
+      for (auto i = 0UL; i < tensor_counts.size(); ++i)
+      {
+        if (bucket_counts.empty() ||
+            bucket_counts.back() + tensor_counts[i] > bucket_capacity)
+        {
+          bucket_counts.push_back(0);
+          bucket_begins.push_back(i);
+        }
+        locations.push_back({bucket_counts.size() - 1, bucket_counts.back()});
+        bucket_counts.back() += tensor_counts[i];
+      }
+      bucket_begins.push_back(tensor_counts.size());
+
+      // buckets use the same connection tags, i.e., they have
+      // to be set up one after the other
+      for (auto const& bucket_count : bucket_counts)
+      {
+        buckets.push_back(std::make_shared<Bucket>(group, bucket_count, reduction_kernel));
+        buckets.back()->waitForSetup();
+        handles.push_back(progress_engine.register_collective(buckets.back()));
+      }
+    }
+
+    template<typename T, AllreduceAlgorithm Algorithm>
+    FusedAllreduce<T, Algorithm>::FusedAllreduce(
+      gaspi::group::Group const& group,
+      std::vector<std::size_t> const& tensor_counts,
+      ReductionKernel<T> reduction_kernel,
+      std::size_t bucket_size_bytes)
+    : FusedAllreduce(group, tensor_counts, reduction_kernel,
+                     gaspi::getRuntime().getDefaultProgressEngine(), bucket_size_bytes)
+    { }
+
+    template<typename T, AllreduceAlgorithm Algorithm>
+    FusedAllreduce<T, Algorithm>::~FusedAllreduce()
+    {
+      for (auto& handle : handles)
+      {
+        progress_engine.deregister_collective(handle);
+      }
+    }
+
+    template<typename T, AllreduceAlgorithm Algorithm>
+    void FusedAllreduce<T, Algorithm>::start(std::vector<Input> const& inputs)
+    {
+      check_tensors(inputs);
+      for (auto b = 0UL; b < buckets.size(); ++b)
+      {
+        auto const bucket_data = static_cast<T*>(buckets[b]->getInPlaceBuffer());
+        for (auto i = bucket_begins[b]; i < bucket_begins[b + 1]; ++i)
+        {
+          std::copy(inputs[i].first, inputs[i].first + inputs[i].second,
+                    bucket_data + locations[i].offset);
+        }
+        buckets[b]->copyIn(bucket_data);
+        buckets[b]->start();
+      }
+    }
+
+    template<typename T, AllreduceAlgorithm Algorithm>
+    void FusedAllreduce<T, Algorithm>::waitForCompletion(std::vector<Output> const& outputs)
+    {
+      check_tensors(outputs);
+      for (auto b = 0UL; b < buckets.size(); ++b)
+      {
+        buckets[b]->waitForCompletion();
+
+        auto const bucket_data = static_cast<T const*>(buckets[b]->getInPlaceBuffer());
+        for (auto i = bucket_begins[b]; i < bucket_begins[b + 1]; ++i)
+        {
+          auto const tensor_begin = bucket_data + locations[i].offset;
+          std::copy(tensor_begin, tensor_begin + outputs[i].second, outputs[i].first);
+        }
+        buckets[b]->copyOut(buckets[b]->getInPlaceBuffer());
+      }
+    }
+
+    template<typename T, AllreduceAlgorithm Algorithm>
+    std::size_t FusedAllreduce<T, Algorithm>::getNumberBuckets() const
+    {
+      return buckets.size();
+    }
+
+    template<typename T, AllreduceAlgorithm Algorithm>
+    template<typename Tensor>
+    void FusedAllreduce<T, Algorithm>::check_tensors(std::vector<Tensor> const& tensors) const
+    {
+      if (tensors.size() != tensor_counts.size())
+      {
+        throw std::logic_error("FusedAllreduce: Wrong number of tensors");
+      }
+      for (auto i = 0UL; i < tensors.size(); ++i)
+      {
+        if (tensors[i].second != tensor_counts[i])
+        {
+          throw std::logic_error("FusedAllreduce: Wrong number of elements in tensor");
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Gatherv.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/Collective.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllgathervCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/GathervBinomialTree.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/GathervCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/GathervDirect.hpp>
+#include <GaspiCxx/progress_engine/ProgressEngine.hpp>
+#include <GaspiCxx/Runtime.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+
+    template<typename T, GathervAlgorithm Algorithm>
+    class Gatherv : public RootedReceiveCollective
+    {
+      public:
+        Gatherv(gaspi::group::Group const& group,
+                std::vector<std::size_t> const& counts,
+                gaspi::group::Rank const& root_rank,
+                progress_engine::ProgressEngine& progress_engine);
+        Gatherv(gaspi::group::Group const& group,
+                std::vector<std::size_t> const& counts,
+                gaspi::group::Rank const& root_rank);
+        // the counts of all ranks are exchanged at construction
+        Gatherv(gaspi::group::Group const& group,
+                std::size_t count,
+                gaspi::group::Rank const& root_rank);
+        ~Gatherv();
+
+        void start(void const* inputs) override;
+        void start(std::vector<T> const& inputs);
+
+        void waitForCompletion(void* outputs) override;
+        void waitForCompletion(std::vector<T>& outputs);
+        void waitForCompletion() override;
+
+        std::size_t getOutputCount() override;
+        std::vector<std::size_t> get_counts();
+
+      private:
+        progress_engine::ProgressEngine& progress_engine;
+        progress_engine::ProgressEngine::CollectiveHandle handle;
+        std::shared_ptr<GathervLowLevel<T, Algorithm>> gatherv_impl;
+        std::vector<std::size_t> counts;
+
+        gaspi::group::Rank root_rank;
+        gaspi::group::Rank rank;
+    };
+
+    template<typename T, GathervAlgorithm Algorithm>
+    class Gather : public Gatherv<T, Algorithm>
+    {
+      public:
+        Gather(gaspi::group::Group const& group,
+               std::size_t count,
+               gaspi::group::Rank const& root_rank,
+               progress_engine::ProgressEngine& progress_engine);
+        Gather(gaspi::group::Group const& group,
+               std::size_t count,
+               gaspi::group::Rank const& root_rank);
+    };
+
+    template<typename T, GathervAlgorithm Algorithm>
+    Gatherv<T, Algorithm>::Gatherv(
+      gaspi::group::Group const& group,
+      std::vector<std::size_t> const& counts,
+      gaspi::group::Rank const& root_rank,
+      progress_engine::ProgressEngine& progress_engine)
+    : progress_engine(progress_engine),
+      handle(),
+      gatherv_impl(std::make_shared<GathervLowLevel<T, Algorithm>>(
+                   group, counts, root_rank)),
+      counts(counts),
+      root_rank(root_rank),
+      rank(group.rank())
+    {
+      gatherv_impl->waitForSetup();
+      handle = progress_engine.register_collective(gatherv_impl);
+    }
+
+    template<typename T, GathervAlgorithm Algorithm>
+    Gatherv<T, Algorithm>::Gatherv(
+      gaspi::group::Group const& group,
+      std::vector<std::size_t> const& counts,
+      gaspi::group::Rank const& root_rank)
+    : Gatherv(group, counts, root_rank,
+              gaspi::getRuntime().getDefaultProgressEngine())
+    { }
+
+    template<typename T, GathervAlgorithm Algorithm>
+    Gatherv<T, Algorithm>::Gatherv(
+      gaspi::group::Group const& group,
+      std::size_t count,
+      gaspi::group::Rank const& root_rank)
+    : Gatherv(group, allgather_counts(group, count), root_rank)
+    { }
+
+    template<typename T, GathervAlgorithm Algorithm>
+    Gatherv<T, Algorithm>::~Gatherv()
+    {
+      progress_engine.deregister_collective(handle);
+    }
+
+    template<typename T, GathervAlgorithm Algorithm>
+    void Gatherv<T, Algorithm>::start(void const* inputs)
+    {
+      gatherv_impl->copyIn(inputs);
+      gatherv_impl->start();
+    }
+
+    template<typename T, GathervAlgorithm Algorithm>
+    void Gatherv<T, Algorithm>::start(std::vector<T> const& inputs)
+    {
+      start(static_cast<void const *>(inputs.data()));
+    }
+
+    template<typename T, GathervAlgorithm Algorithm>
+    void Gatherv<T, Algorithm>::waitForCompletion(void* outputs)
+    {
+      if(rank != root_rank)
+      {
+        throw std::logic_error(
+          "Gatherv: waitForCompletion(void* outputs) may only be called on root rank.");
+      }
+      gatherv_impl->waitForCompletion();
+      gatherv_impl->copyOut(outputs);
+    }
+
+    template<typename T, GathervAlgorithm Algorithm>
+    void Gatherv<T, Algorithm>::waitForCompletion(std::vector<T>& outputs)
+    {
+      waitForCompletion(static_cast<void*>(outputs.data()));
+    }
+
+    template<typename T, GathervAlgorithm Algorithm>
+    void Gatherv<T, Algorithm>::waitForCompletion()
+    {
+      if(rank == root_rank)
+      {
+        throw std::logic_error(
+          "Gatherv: waitForCompletion() may only be called on non-root ranks.");
+      }
+      gatherv_impl->waitForCompletion();
+      gatherv_impl->copyOut(CollectiveLowLevel::NO_DATA);
+    }
+
+    template<typename T, GathervAlgorithm Algorithm>
+    std::size_t Gatherv<T, Algorithm>::getOutputCount()
+    {
+      return gatherv_impl->getOutputCount();
+    }
+
+    template<typename T, GathervAlgorithm Algorithm>
+    std::vector<std::size_t> Gatherv<T, Algorithm>::get_counts()
+    {
+      return counts;
+    }
+
+    template<typename T, GathervAlgorithm Algorithm>
+    Gather<T, Algorithm>::Gather(
+      gaspi::group::Group const& group,
+      std::size_t count,
+      gaspi::group::Rank const& root_rank,
+      progress_engine::ProgressEngine& progress_engine)
+    : Gatherv<T, Algorithm>(group, std::vector<std::size_t>(group.size(), count),
+                            root_rank, progress_engine)
+    { }
+
+    template<typename T, GathervAlgorithm Algorithm>
+    Gather<T, Algorithm>::Gather(
+      gaspi::group::Group const& group,
+      std::size_t count,
+      gaspi::group::Rank const& root_rank)
+    : Gather(group, count, root_rank,
+             gaspi::getRuntime().getDefaultProgressEngine())
+    { }
+  }
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * NeighborAlltoallv.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/Collective.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/NeighborCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/NeighborDirect.hpp>
+#include <GaspiCxx/progress_engine/ProgressEngine.hpp>
+#include <GaspiCxx/Runtime.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+
+    // Persistent exchange along the edges of a (sparse) communication graph
+    // (cf. `NeighborGraph`), e.g., the halo exchange of a stencil code
+    template<typename T, NeighborAlgorithm Algorithm>
+    class NeighborAlltoallv : public Collective
+    {
+      public:
+        NeighborAlltoallv(gaspi::group::Group const& group,
+                          NeighborGraph const& graph,
+                          std::vector<std::size_t> const& send_counts,
+                          std::vector<std::size_t> const& recv_counts,
+                          progress_engine::ProgressEngine& progress_engine);
+        NeighborAlltoallv(gaspi::group::Group const& group,
+                          NeighborGraph const& graph,
+                          std::vector<std::size_t> const& send_counts,
+                          std::vector<std::size_t> const& recv_counts);
+        ~NeighborAlltoallv();
+
+        void start(void const* inputs) override;
+        void start(std::vector<T> const& inputs);
+
+        void waitForCompletion(void* outputs) override;
+        void waitForCompletion(std::vector<T>& outputs);
+
+        std::size_t getOutputCount() override;
+
+      protected:
+        NeighborAlltoallv(std::shared_ptr<NeighborAlltoallvLowLevel<T, Algorithm>> neighbor_impl,
+                          progress_engine::ProgressEngine& progress_engine);
+
+      private:
+        progress_engine::ProgressEngine& progress_engine;
+        progress_engine::ProgressEngine::CollectiveHandle handle;
+        std::shared_ptr<NeighborAlltoallvLowLevel<T, Algorithm>> neighbor_impl;
+    };
+
+    // Each rank sends the same `count` elements to all its destinations,
+    // and receives the concatenated blocks of its sources
+    template<typename T, NeighborAlgorithm Algorithm>
+    class NeighborAllgather : public NeighborAlltoallv<T, Algorithm>
+    {
+      public:
+        NeighborAllgather(gaspi::group::Group const& group,
+                          NeighborGraph const& graph,
+                          std::size_t count,
+                          progress_engine::ProgressEngine& progress_engine);
+        NeighborAllgather(gaspi::group::Group const& group,
+                          NeighborGraph const& graph,
+                          std::size_t count);
+    };
+
+    template<typename T, NeighborAlgorithm Algorithm>
+    NeighborAlltoallv<T, Algorithm>::NeighborAlltoallv(
+      std::shared_ptr<NeighborAlltoallvLowLevel<T, Algorithm>> neighbor_impl,
+      progress_engine::ProgressEngine& progress_engine)
+    : progress_engine(progress_engine),
+      handle(),
+      neighbor_impl(neighbor_impl)
+    {
+      neighbor_impl->waitForSetup();
+      handle = progress_engine.register_collective(neighbor_impl);
+    }
+
+    template<typename T, NeighborAlgorithm Algorithm>
+    NeighborAlltoallv<T, Algorithm>::NeighborAlltoallv(
+      gaspi::group::Group const& group,
+      NeighborGraph const& graph,
+      std::vector<std::size_t> const& send_counts,
+      std::vector<std::size_t> const& recv_counts,
+      progress_engine::ProgressEngine& progress_engine)
+    : NeighborAlltoallv(std::make_shared<NeighborAlltoallvLowLevel<T, Algorithm>>(
+                          group, graph, send_counts, recv_counts),
+                        progress_engine)
+    { }
+
+    template<typename T, NeighborAlgorithm Algorithm>
+    NeighborAlltoallv<T, Algorithm>::NeighborAlltoallv(
+      gaspi::group::Group const& group,
+      NeighborGraph const& graph,
+      std::vector<std::size_t> const& send_counts,
+      std::vector<std::size_t> const& recv_counts)
+    : NeighborAlltoallv(group, graph, send_counts, recv_counts,
+                        gaspi::getRuntime().getDefaultProgressEngine())
+    { }
+
+    template<typename T, NeighborAlgorithm Algorithm>
+    NeighborAlltoallv<T, Algorithm>::~NeighborAlltoallv()
+    {
+      progress_engine.deregister_collective(handle);
+    }
+
+    template<typename T, NeighborAlgorithm Algorithm>
+    void NeighborAlltoallv<T, Algorithm>::start(void const* inputs)
+    {
+      neighbor_impl->copyIn(inputs);
+      neighbor_impl->start();
+    }
+
+    template<typename T, NeighborAlgorithm Algorithm>
+    void NeighborAlltoallv<T, Algorithm>::start(std::vector<T> const& inputs)
+    {
+      start(static_cast<void const *>(inputs.data()));
+    }
+
+    template<typename T, NeighborAlgorithm Algorithm>
+    void NeighborAlltoallv<T, Algorithm>::waitForCompletion(void* outputs)
+    {
+      neighbor_impl->waitForCompletion();
+      neighbor_impl->copyOut(outputs);
+    }
+
+    template<typename T, NeighborAlgorithm Algorithm>
+    void NeighborAlltoallv<T, Algorithm>::waitForCompletion(std::vector<T>& outputs)
+    {
+      waitForCompletion(static_cast<void*>(outputs.data()));
+    }
+
+    template<typename T, NeighborAlgorithm Algorithm>
+    std::size_t NeighborAlltoallv<T, Algorithm>::getOutputCount()
+    {
+      return neighbor_impl->getOutputCount();
+    }
+
+    template<typename T, NeighborAlgorithm Algorithm>
+    NeighborAllgather<T, Algorithm>::NeighborAllgather(
+      gaspi::group::Group const& group,
+      NeighborGraph const& graph,
+      std::size_t count,
+      progress_engine::ProgressEngine& progress_engine)
+    : NeighborAlltoallv<T, Algorithm>(
+        std::make_shared<NeighborAllgatherLowLevel<T, Algorithm>>(group, graph, count),
+        progress_engine)
+    { }
+
+    template<typename T, NeighborAlgorithm Algorithm>
+    NeighborAllgather<T, Algorithm>::NeighborAllgather(
+      gaspi::group::Group const& group,
+      NeighborGraph const& graph,
+      std::size_t count)
+    : NeighborAllgather(group, graph, count, gaspi::getRuntime().getDefaultProgressEngine())
+    { }
+  }
+}
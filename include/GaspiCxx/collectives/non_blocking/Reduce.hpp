@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Reduce.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/Collective.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/ReduceCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/ReduceBinomialTree.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/ReducePipelinedChain.hpp>
+#include <GaspiCxx/progress_engine/ProgressEngine.hpp>
+#include <GaspiCxx/Runtime.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+
+    template<typename T, ReduceAlgorithm Algorithm>
+    class Reduce : public RootedReceiveCollective
+    {
+      public:
+        Reduce(gaspi::group::Group const& group,
+               std::size_t number_elements,
+               gaspi::group::Rank const& root_rank,
+               ReductionKernel<T> reduction_kernel,
+               progress_engine::ProgressEngine& progress_engine);
+        Reduce(gaspi::group::Group const& group,
+               std::size_t number_elements,
+               gaspi::group::Rank const& root_rank,
+               ReductionKernel<T> reduction_kernel);
+        ~Reduce();
+
+        void start(void const* inputs) override;
+        void start(std::vector<T> const& inputs);
+
+        void waitForCompletion(void* outputs) override;
+        void waitForCompletion(std::vector<T>& outputs);
+        void waitForCompletion() override;
+
+        std::size_t getOutputCount() override;
+
+      private:
+        progress_engine::ProgressEngine& progress_engine;
+        progress_engine::ProgressEngine::CollectiveHandle handle;
+        std::shared_ptr<ReduceLowLevel<T, Algorithm>> reduce_impl;
+
+        gaspi::group::Rank root_rank;
+        gaspi::group::Rank rank;
+    };
+
+    template<typename T, ReduceAlgorithm Algorithm>
+    Reduce<T, Algorithm>::Reduce(
+      gaspi::group::Group const& group,
+      std::size_t number_elements,
+      gaspi::group::Rank const& root_rank,
+      ReductionKernel<T> reduction_kernel,
+      progress_engine::ProgressEngine& progress_engine)
+    : progress_engine(progress_engine),
+      handle(),
+      reduce_impl(std::make_shared<ReduceLowLevel<T, Algorithm>>(
+                  group, number_elements, root_rank, reduction_kernel)),
+      root_rank(root_rank),
+      rank(group.rank())
+    {
+      reduce_impl->waitForSetup();
+      handle = progress_engine.register_collective(reduce_impl);
+    }
+
+    template<typename T, ReduceAlgorithm Algorithm>
+    Reduce<T, Algorithm>::Reduce(
+      gaspi::group::Group const& group,
+      std::size_t number_elements,
+      gaspi::group::Rank const& root_rank,
+      ReductionKernel<T> reduction_kernel)
+    : Reduce(group, number_elements, root_rank, reduction_kernel,
+             gaspi::getRuntime().getDefaultProgressEngine())
+    { }
+
+    template<typename T, ReduceAlgorithm Algorithm>
+    Reduce<T, Algorithm>::~Reduce()
+    {
+      progress_engine.deregister_collective(handle);
+    }
+
+    template<typename T, ReduceAlgorithm Algorithm>
+    void Reduce<T, Algorithm>::start(void const* inputs)
+    {
+      reduce_impl->copyIn(inputs);
+      reduce_impl->start();
+    }
+
+    template<typename T, ReduceAlgorithm Algorithm>
+    void Reduce<T, Algorithm>::start(std::vector<T> const& inputs)
+    {
+      start(static_cast<void const *>(inputs.data()));
+    }
+
+    template<typename T, ReduceAlgorithm Algorithm>
+    void Reduce<T, Algorithm>::waitForCompletion(void* outputs)
+    {
+      if(rank != root_rank)
+      {
+        throw std::logic_error(
+          "Reduce: waitForCompletion(void* outputs) may only be called on root rank.");
+      }
+      reduce_impl->waitForCompletion();
+      reduce_impl->copyOut(outputs);
+    }
+
+    template<typename T, ReduceAlgorithm Algorithm>
+    void Reduce<T, Algorithm>::waitForCompletion(std::vector<T>& outputs)
+    {
+      waitForCompletion(static_cast<void*>(outputs.data()));
+    }
+
+    template<typename T, ReduceAlgorithm Algorithm>
+    void Reduce<T, Algorithm>::waitForCompletion()
+    {
+      if(rank == root_rank)
+      {
+        throw std::logic_error(
+          "Reduce: waitForCompletion() may only be called on non-root ranks.");
+      }
+      reduce_impl->waitForCompletion();
+      reduce_impl->copyOut(CollectiveLowLevel::NO_DATA);
+    }
+
+    template<typename T, ReduceAlgorithm Algorithm>
+    std::size_t Reduce<T, Algorithm>::getOutputCount()
+    {
+      return reduce_impl->getOutputCount();
+    }
+  }
+}
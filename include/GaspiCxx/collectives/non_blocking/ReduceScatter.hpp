@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ReduceScatter.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/Collective.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/ReduceScatterCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/ReduceScatterRing.hpp>
+#include <GaspiCxx/progress_engine/ProgressEngine.hpp>
+#include <GaspiCxx/Runtime.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+
+    // The inputs consist of one block per rank, stored contiguously,
+    // of which each rank receives the reduced values of its own block.
+    // Blocks have `count` elements each, or `counts[i]` elements for rank `i`
+    // (the same `counts` on all ranks).
+    template<typename T, ReduceScatterAlgorithm Algorithm>
+    class ReduceScatter : public VariousCountCollective
+    {
+      public:
+        ReduceScatter(gaspi::group::Group const& group,
+                      std::vector<std::size_t> const& counts,
+                      ReductionKernel<T> reduction_kernel,
+                      progress_engine::ProgressEngine& progress_engine);
+        ReduceScatter(gaspi::group::Group const& group,
+                      std::vector<std::size_t> const& counts,
+                      ReductionKernel<T> reduction_kernel);
+        ReduceScatter(gaspi::group::Group const& group,
+                      std::size_t count,
+                      ReductionKernel<T> reduction_kernel);
+        ~ReduceScatter();
+
+        void start(void const* inputs) override;
+        void start(std::vector<T> const& inputs);
+
+        void waitForCompletion(void* outputs) override;
+        void waitForCompletion(std::vector<T>& outputs);
+
+        std::size_t getOutputCount() override;
+        std::vector<std::size_t> get_counts() override;
+
+      private:
+        progress_engine::ProgressEngine& progress_engine;
+        progress_engine::ProgressEngine::CollectiveHandle handle;
+        std::shared_ptr<ReduceScatterLowLevel<T, Algorithm>> reduce_scatter_impl;
+        std::vector<std::size_t> counts;
+    };
+
+    template<typename T, ReduceScatterAlgorithm Algorithm>
+    ReduceScatter<T, Algorithm>::ReduceScatter(
+      gaspi::group::Group const& group,
+      std::vector<std::size_t> const& counts,
+      ReductionKernel<T> reduction_kernel,
+      progress_engine::ProgressEngine& progress_engine)
+    : progress_engine(progress_engine),
+      handle(),
+      reduce_scatter_impl(std::make_shared<ReduceScatterLowLevel<T, Algorithm>>(
+                          group, counts, reduction_kernel)),
+      counts(counts)
+    {
+      reduce_scatter_impl->waitForSetup();
+      handle = progress_engine.register_collective(reduce_scatter_impl);
+    }
+
+    template<typename T, ReduceScatterAlgorithm Algorithm>
+    ReduceScatter<T, Algorithm>::ReduceScatter(
+      gaspi::group::Group const& group,
+      std::vector<std::size_t> const& counts,
+      ReductionKernel<T> reduction_kernel)
+    : ReduceScatter(group, counts, reduction_kernel,
+                    gaspi::getRuntime().getDefaultProgressEngine())
+    { }
+
+    template<typename T, ReduceScatterAlgorithm Algorithm>
+    ReduceScatter<T, Algorithm>::ReduceScatter(
+      gaspi::group::Group const& group,
+      std::size_t count,
+      ReductionKernel<T> reduction_kernel)
+    : ReduceScatter(group, std::vector<std::size_t>(group.size(), count),
+                    reduction_kernel)
+    { }
+
+    template<typename T, ReduceScatterAlgorithm Algorithm>
+    ReduceScatter<T, Algorithm>::~ReduceScatter()
+    {
+      progress_engine.deregister_collective(handle);
+    }
+
+    template<typename T, ReduceScatterAlgorithm Algorithm>
+    void ReduceScatter<T, Algorithm>::start(void const* inputs)
+    {
+      reduce_scatter_impl->copyIn(inputs);
+      reduce_scatter_impl->start();
+    }
+
+    template<typename T, ReduceScatterAlgorithm Algorithm>
+    void ReduceScatter<T, Algorithm>::start(std::vector<T> const& inputs)
+    {
+      start(static_cast<void const *>(inputs.data()));
+    }
+
+    template<typename T, ReduceScatterAlgorithm Algorithm>
+    void ReduceScatter<T, Algorithm>::waitForCompletion(void* outputs)
+    {
+      reduce_scatter_impl->waitForCompletion();
+      reduce_scatter_impl->copyOut(outputs);
+    }
+
+    template<typename T, ReduceScatterAlgorithm Algorithm>
+    void ReduceScatter<T, Algorithm>::waitForCompletion(std::vector<T>& outputs)
+    {
+      waitForCompletion(static_cast<void*>(outputs.data()));
+    }
+
+    template<typename T, ReduceScatterAlgorithm Algorithm>
+    std::size_t ReduceScatter<T, Algorithm>::getOutputCount()
+    {
+      return reduce_scatter_impl->getOutputCount();
+    }
+
+    template<typename T, ReduceScatterAlgorithm Algorithm>
+    std::vector<std::size_t> ReduceScatter<T, Algorithm>::get_counts()
+    {
+      return counts;
+    }
+  }
+}
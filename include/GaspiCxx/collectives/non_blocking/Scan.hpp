@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Scan.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/Collective.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/ScanCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/ScanRecursiveDoubling.hpp>
+#include <GaspiCxx/progress_engine/ProgressEngine.hpp>
+#include <GaspiCxx/Runtime.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+
+    // Inclusive prefix reduction: rank `i` obtains the reduction of the
+    // inputs of ranks 0..i
+    template<typename T, ScanAlgorithm Algorithm>
+    class Scan : public Collective
+    {
+      public:
+        Scan(gaspi::group::Group const& group,
+             std::size_t number_elements,
+             ReductionKernel<T> reduction_kernel,
+             progress_engine::ProgressEngine& progress_engine);
+        Scan(gaspi::group::Group const& group,
+             std::size_t number_elements,
+             ReductionKernel<T> reduction_kernel);
+        ~Scan();
+
+        void start(void const* inputs) override;
+        void start(std::vector<T> const& inputs);
+
+        void waitForCompletion(void* outputs) override;
+        void waitForCompletion(std::vector<T>& outputs);
+
+        std::size_t getOutputCount() override;
+
+      protected:
+        Scan(gaspi::group::Group const& group,
+             std::size_t number_elements,
+             ScanType scan_type,
+             ReductionKernel<T> reduction_kernel,
+             progress_engine::ProgressEngine& progress_engine);
+
+      private:
+        progress_engine::ProgressEngine& progress_engine;
+        progress_engine::ProgressEngine::CollectiveHandle handle;
+        std::shared_ptr<ScanLowLevel<T, Algorithm>> scan_impl;
+    };
+
+    // Exclusive prefix reduction: rank `i` obtains the reduction of the
+    // inputs of ranks 0..i-1, rank 0 has no outputs
+    template<typename T, ScanAlgorithm Algorithm>
+    class Exscan : public Scan<T, Algorithm>
+    {
+      public:
+        Exscan(gaspi::group::Group const& group,
+               std::size_t number_elements,
+               ReductionKernel<T> reduction_kernel,
+               progress_engine::ProgressEngine& progress_engine);
+        Exscan(gaspi::group::Group const& group,
+               std::size_t number_elements,
+               ReductionKernel<T> reduction_kernel);
+    };
+
+    template<typename T, ScanAlgorithm Algorithm>
+    Scan<T, Algorithm>::Scan(
+      gaspi::group::Group const& group,
+      std::size_t number_elements,
+      ScanType scan_type,
+      ReductionKernel<T> reduction_kernel,
+      progress_engine::ProgressEngine& progress_engine)
+    : progress_engine(progress_engine),
+      handle(),
+      scan_impl(std::make_shared<ScanLowLevel<T, Algorithm>>(
+                group, number_elements, scan_type, reduction_kernel))
+    {
+      scan_impl->waitForSetup();
+      handle = progress_engine.register_collective(scan_impl);
+    }
+
+    template<typename T, ScanAlgorithm Algorithm>
+    Scan<T, Algorithm>::Scan(
+      gaspi::group::Group const& group,
+      std::size_t number_elements,
+      ReductionKernel<T> reduction_kernel,
+      progress_engine::ProgressEngine& progress_engine)
+    : Scan(group, number_elements, ScanType::INCLUSIVE, reduction_kernel, progress_engine)
+    { }
+
+    template<typename T, ScanAlgorithm Algorithm>
+    Scan<T, Algorithm>::Scan(
+      gaspi::group::Group const& group,
+      std::size_t number_elements,
+      ReductionKernel<T> reduction_kernel)
+    : Scan(group, number_elements, reduction_kernel,
+           gaspi::getRuntime().getDefaultProgressEngine())
+    { }
+
+    template<typename T, ScanAlgorithm Algorithm>
+    Scan<T, Algorithm>::~Scan()
+    {
+      progress_engine.deregister_collective(handle);
+    }
+
+    template<typename T, ScanAlgorithm Algorithm>
+    void Scan<T, Algorithm>::start(void const* inputs)
+    {
+      scan_impl->copyIn(inputs);
+      scan_impl->start();
+    }
+
+    template<typename T, ScanAlgorithm Algorithm>
+    void Scan<T, Algorithm>::start(std::vector<T> const& inputs)
+    {
+      start(static_cast<void const *>(inputs.data()));
+    }
+
+    template<typename T, ScanAlgorithm Algorithm>
+    void Scan<T, Algorithm>::waitForCompletion(void* outputs)
+    {
+      scan_impl->waitForCompletion();
+      scan_impl->copyOut(outputs);
+    }
+
+    template<typename T, ScanAlgorithm Algorithm>
+    void Scan<T, Algorithm>::waitForCompletion(std::vector<T>& outputs)
+    {
+      waitForCompletion(static_cast<void*>(outputs.data()));
+    }
+
+    template<typename T, ScanAlgorithm Algorithm>
+    std::size_t Scan<T, Algorithm>::getOutputCount()
+    {
+      return scan_impl->getOutputCount();
+    }
+
+    template<typename T, ScanAlgorithm Algorithm>
+    Exscan<T, Algorithm>::Exscan(
+      gaspi::group::Group const& group,
+      std::size_t number_elements,
+      ReductionKernel<T> reduction_kernel,
+      progress_engine::ProgressEngine& progress_engine)
+    : Scan<T, Algorithm>(group, number_elements, ScanType::EXCLUSIVE,
+                         reduction_kernel, progress_engine)
+    { }
+
+    template<typename T, ScanAlgorithm Algorithm>
+    Exscan<T, Algorithm>::Exscan(
+      gaspi::group::Group const& group,
+      std::size_t number_elements,
+      ReductionKernel<T> reduction_kernel)
+    : Exscan(group, number_elements, reduction_kernel,
+             gaspi::getRuntime().getDefaultProgressEngine())
+    { }
+  }
+}
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Scatterv.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/Collective.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllgathervCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/ScattervBinomialTree.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/ScattervCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/ScattervDirect.hpp>
+#include <GaspiCxx/progress_engine/ProgressEngine.hpp>
+#include <GaspiCxx/Runtime.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+
+    template<typename T, ScattervAlgorithm Algorithm>
+    class Scatterv : public RootedSendCollective
+    {
+      public:
+        Scatterv(gaspi::group::Group const& group,
+                 std::vector<std::size_t> const& counts,
+                 gaspi::group::Rank const& root_rank,
+                 progress_engine::ProgressEngine& progress_engine);
+        Scatterv(gaspi::group::Group const& group,
+                 std::vector<std::size_t> const& counts,
+                 gaspi::group::Rank const& root_rank);
+        // the counts of all ranks are exchanged at construction
+        Scatterv(gaspi::group::Group const& group,
+                 std::size_t count,
+                 gaspi::group::Rank const& root_rank);
+        ~Scatterv();
+
+        void start(void const* inputs) override;
+        void start(std::vector<T> const& inputs);
+        void start() override;
+
+        void waitForCompletion(void* outputs) override;
+        void waitForCompletion(std::vector<T>& outputs);
+
+        std::size_t getOutputCount() override;
+        std::vector<std::size_t> get_counts();
+
+      private:
+        progress_engine::ProgressEngine& progress_engine;
+        progress_engine::ProgressEngine::CollectiveHandle handle;
+        std::shared_ptr<ScattervLowLevel<T, Algorithm>> scatterv_impl;
+        std::vector<std::size_t> counts;
+
+        gaspi::group::Rank root_rank;
+        gaspi::group::Rank rank;
+    };
+
+    template<typename T, ScattervAlgorithm Algorithm>
+    class Scatter : public Scatterv<T, Algorithm>
+    {
+      public:
+        Scatter(gaspi::group::Group const& group,
+                std::size_t count,
+                gaspi::group::Rank const& root_rank,
+                progress_engine::ProgressEngine& progress_engine);
+        Scatter(gaspi::group::Group const& group,
+                std::size_t count,
+                gaspi::group::Rank const& root_rank);
+    };
+
+    template<typename T, ScattervAlgorithm Algorithm>
+    Scatterv<T, Algorithm>::Scatterv(
+      gaspi::group::Group const& group,
+      std::vector<std::size_t> const& counts,
+      gaspi::group::Rank const& root_rank,
+      progress_engine::ProgressEngine& progress_engine)
+    : progress_engine(progress_engine),
+      handle(),
+      scatterv_impl(std::make_shared<ScattervLowLevel<T, Algorithm>>(
+                    group, counts, root_rank)),
+      counts(counts),
+      root_rank(root_rank),
+      rank(group.rank())
+    {
+      scatterv_impl->waitForSetup();
+      handle = progress_engine.register_collective(scatterv_impl);
+    }
+
+    template<typename T, ScattervAlgorithm Algorithm>
+    Scatterv<T, Algorithm>::Scatterv(
+      gaspi::group::Group const& group,
+      std::vector<std::size_t> const& counts,
+      gaspi::group::Rank const& root_rank)
+    : Scatterv(group, counts, root_rank,
+               gaspi::getRuntime().getDefaultProgressEngine())
+    { }
+
+    template<typename T, ScattervAlgorithm Algorithm>
+    Scatterv<T, Algorithm>::Scatterv(
+      gaspi::group::Group const& group,
+      std::size_t count,
+      gaspi::group::Rank const& root_rank)
+    : Scatterv(group, allgather_counts(group, count), root_rank)
+    { }
+
+    template<typename T, ScattervAlgorithm Algorithm>
+    Scatterv<T, Algorithm>::~Scatterv()
+    {
+      progress_engine.deregister_collective(handle);
+    }
+
+    template<typename T, ScattervAlgorithm Algorithm>
+    void Scatterv<T, Algorithm>::start(void const* inputs)
+    {
+      if(rank != root_rank)
+      {
+        throw std::logic_error(
+          "Scatterv: start(void const* inputs) may only be called on root rank.");
+      }
+      scatterv_impl->copyIn(inputs);
+      scatterv_impl->start();
+    }
+
+    template<typename T, ScattervAlgorithm Algorithm>
+    void Scatterv<T, Algorithm>::start(std::vector<T> const& inputs)
+    {
+      start(static_cast<void const *>(inputs.data()));
+    }
+
+    template<typename T, ScattervAlgorithm Algorithm>
+    void Scatterv<T, Algorithm>::start()
+    {
+      if(rank == root_rank)
+      {
+        throw std::logic_error("Scatterv: start() may only be called on non-root ranks.");
+      }
+      scatterv_impl->copyIn(CollectiveLowLevel::NO_DATA);
+      scatterv_impl->start();
+    }
+
+    template<typename T, ScattervAlgorithm Algorithm>
+    void Scatterv<T, Algorithm>::waitForCompletion(void* outputs)
+    {
+      scatterv_impl->waitForCompletion();
+      scatterv_impl->copyOut(outputs);
+    }
+
+    template<typename T, ScattervAlgorithm Algorithm>
+    void Scatterv<T, Algorithm>::waitForCompletion(std::vector<T>& outputs)
+    {
+      waitForCompletion(static_cast<void*>(outputs.data()));
+    }
+
+    template<typename T, ScattervAlgorithm Algorithm>
+    std::size_t Scatterv<T, Algorithm>::getOutputCount()
+    {
+      return scatterv_impl->getOutputCount();
+    }
+
+    template<typename T, ScattervAlgorithm Algorithm>
+    std::vector<std::size_t> Scatterv<T, Algorithm>::get_counts()
+    {
+      return counts;
+    }
+
+    template<typename T, ScattervAlgorithm Algorithm>
+    Scatter<T, Algorithm>::Scatter(
+      gaspi::group::Group const& group,
+      std::size_t count,
+      gaspi::group::Rank const& root_rank,
+      progress_engine::ProgressEngine& progress_engine)
+    : Scatterv<T, Algorithm>(group, std::vector<std::size_t>(group.size(), count),
+                             root_rank, progress_engine)
+    { }
+
+    template<typename T, ScattervAlgorithm Algorithm>
+    Scatter<T, Algorithm>::Scatter(
+      gaspi::group::Group const& group,
+      std::size_t count,
+      gaspi::group::Rank const& root_rank)
+    : Scatter(group, count, root_rank,
+              gaspi::getRuntime().getDefaultProgressEngine())
+    { }
+  }
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * SparseAllreduce.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/Collective.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/SparseAllreduceRecursiveDoubling.hpp>
+#include <GaspiCxx/progress_engine/ProgressEngine.hpp>
+#include <GaspiCxx/Runtime.hpp>
+
+#include <memory>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // Allreduce of sparse vectors (cf. `SparseAllreduceLowLevel`),
+    // whose inputs and outputs are `SparseVector<T>`
+    template<typename T>
+    class SparseAllreduce : public Collective
+    {
+      public:
+        SparseAllreduce(gaspi::group::Group const& group,
+                        std::size_t number_elements,
+                        ReductionKernel<T> reduction_kernel,
+                        progress_engine::ProgressEngine& progress_engine,
+                        double density_threshold = SparseAllreduceSettings::density_threshold);
+        SparseAllreduce(gaspi::group::Group const& group,
+                        std::size_t number_elements,
+                        ReductionKernel<T> reduction_kernel,
+                        double density_threshold = SparseAllreduceSettings::density_threshold);
+        ~SparseAllreduce();
+
+        void start(void const* inputs) override;
+        void start(SparseVector<T> const& inputs);
+
+        void waitForCompletion(void* outputs) override;
+        void waitForCompletion(SparseVector<T>& outputs);
+
+        std::size_t getOutputCount() override;
+
+      private:
+        progress_engine::ProgressEngine& progress_engine;
+        progress_engine::ProgressEngine::CollectiveHandle handle;
+        std::shared_ptr<SparseAllreduceLowLevel<T>> allreduce_impl;
+    };
+
+    template<typename T>
+    SparseAllreduce<T>::SparseAllreduce(
+      gaspi::group::Group const& group,
+      std::size_t number_elements,
+      ReductionKernel<T> reduction_kernel,
+      progress_engine::ProgressEngine& progress_engine,
+      double density_threshold)
+    : progress_engine(progress_engine),
+      handle(),
+      allreduce_impl(std::make_shared<SparseAllreduceLowLevel<T>>(
+                     group, number_elements, reduction_kernel, density_threshold))
+    {
+      allreduce_impl->waitForSetup();
+      handle = progress_engine.register_collective(allreduce_impl);
+    }
+
+    template<typename T>
+    SparseAllreduce<T>::SparseAllreduce(
+      gaspi::group::Group const& group,
+      std::size_t number_elements,
+      ReductionKernel<T> reduction_kernel,
+      double density_threshold)
+    : SparseAllreduce(group, number_elements, reduction_kernel,
+                      gaspi::getRuntime().getDefaultProgressEngine(), density_threshold)
+    { }
+
+    template<typename T>
+    SparseAllreduce<T>::~SparseAllreduce()
+    {
+      progress_engine.deregister_collective(handle);
+    }
+
+    template<typename T>
+    void SparseAllreduce<T>::start(void const* inputs)
+    {
+      allreduce_impl->copyIn(inputs);
+      allreduce_impl->start();
+    }
+
+    template<typename T>
+    void SparseAllreduce<T>::start(SparseVector<T> const& inputs)
+    {
+      start(static_cast<void const*>(&inputs));
+    }
+
+    template<typename T>
+    void SparseAllreduce<T>::waitForCompletion(void* outputs)
+    {
+      allreduce_impl->waitForCompletion();
+      allreduce_impl->copyOut(outputs);
+    }
+
+    template<typename T>
+    void SparseAllreduce<T>::waitForCompletion(SparseVector<T>& outputs)
+    {
+      waitForCompletion(static_cast<void*>(&outputs));
+    }
+
+    template<typename T>
+    std::size_t SparseAllreduce<T>::getOutputCount()
+    {
+      return allreduce_impl->getOutputCount();
+    }
+  }
+}
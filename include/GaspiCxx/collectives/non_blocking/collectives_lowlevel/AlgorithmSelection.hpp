@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * AlgorithmSelection.hpp
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // Runtime selection of collective algorithms
+    // ==========================================
+    // A selection table is a list of rules, of which the first one
+    // whose bounds include the number of ranks and the message size
+    // (in bytes) selects the algorithm, given by its name
+    // (cf. `names` of the collective's Info class).
+    //
+    // Textual format: rules `<max ranks>:<max bytes>:<algorithm>`,
+    // separated by commas or whitespace, where `*` stands for no bound,
+    // e.g., "4:16384:recursivedoubling, *:*:ring".
+    struct SelectionRule
+    {
+      static constexpr std::size_t unbounded = std::numeric_limits<std::size_t>::max();
+
+      std::size_t max_number_ranks;
+      std::size_t max_message_bytes;
+      std::string algorithm;
+
+      bool operator==(SelectionRule const& other) const
+      {
+        return max_number_ranks == other.max_number_ranks &&
+               max_message_bytes == other.max_message_bytes &&
+               algorithm == other.algorithm;
+      }
+    };
+    using SelectionTable = std::vector<SelectionRule>;
+
+    SelectionTable parse_selection_table(std::string const& description);
+    std::string to_string(SelectionTable const& table);
+
+    // Throws if no rule matches
+    std::string const& select_algorithm_name(SelectionTable const& table,
+                                             std::size_t number_ranks,
+                                             std::size_t message_bytes);
+
+    // Maps an algorithm name to the algorithm of the Info class
+    template<typename Info>
+    typename Info::Algorithm get_algorithm_by_name(std::string const& name)
+    {
+      for (auto const& [algorithm, algorithm_name] : Info::names)
+      {
+        if (algorithm_name == name) { return algorithm; }
+      }
+      throw std::logic_error("get_algorithm_by_name: Unknown algorithm " + name);
+    }
+  }
+}
@@ -62,5 +62,10 @@ namespace gaspi
     template<typename T, AllgathervAlgorithm Algorithm>
     class AllgathervLowLevel : public AllgathervCommon
     { };
+
+    // Exchanges the `count` of each rank in the `group`, e.g., to set up
+    // collectives with various counts (collective call)
+    std::vector<std::size_t> allgather_counts(gaspi::group::Group const& group,
+                                              std::size_t count);
   }
 }
\ No newline at end of file
@@ -54,7 +54,9 @@ namespace gaspi
         std::vector<std::unique_ptr<SourceBuffer>> source_buffers;
         std::vector<std::unique_ptr<TargetBuffer>> target_buffers;
         std::vector<ConnectHandle> handles;
-        std::vector<T> data_for_1rank_case;
+        // received parts are stored as soon as they arrive, such that
+        // the next run of the left neighbor may overwrite the buffers
+        std::vector<T> gathered_data;
         std::size_t current_step;
 
         void waitForSetupImpl() override;
@@ -76,7 +78,7 @@ namespace gaspi
       number_ranks(group.size()),
       source_buffers(), target_buffers(),
       handles(),
-      data_for_1rank_case(),
+      gathered_data(number_elements),
       current_step(0)
     {
       if(number_ranks > 1)
@@ -109,10 +111,6 @@ namespace gaspi
               target_buffers[i]->connectToRemoteSource(group, left_neighbor, target_tag));
         }
       }
-      else
-      {
-        data_for_1rank_case.resize(number_elements); 
-      }
     }
 
     template<typename T>
@@ -138,17 +136,11 @@ namespace gaspi
     void AllgathervLowLevel<T, AllgathervAlgorithm::RING>::copyInImpl(void const* inputs)
     {
       auto current_begin = static_cast<T const*>(inputs);
-      
-      if (number_ranks == 1)
-      {
-        std::copy(current_begin, current_begin + number_elements,
-                  data_for_1rank_case.begin());
-      }
-      else
-      {
-        auto elements_to_copy = source_buffers[0]->description().size()/sizeof(T);
-        auto const current_end = current_begin + elements_to_copy;
+      auto const current_end = current_begin + counts[rank.get()];
+      std::copy(current_begin, current_end, gathered_data.begin() + offsets[rank.get()]);
 
+      if (number_ranks > 1)
+      {
         std::copy(current_begin, current_end, static_cast<T*>(source_buffers[0]->address()));
       }
     }
@@ -167,6 +159,12 @@ namespace gaspi
       auto made_progress = target_buffers[current_step]->checkForCompletion();
       if (!made_progress) { return false; }
 
+      // in step `s`, the part of rank `rank - s - 1` is received
+      auto const receive_index = (rank.get() + number_ranks - current_step - 1) % number_ranks;
+      auto const received = static_cast<T const*>(target_buffers[current_step]->address());
+      std::copy(received, received + counts[receive_index],
+                gathered_data.begin() + offsets[receive_index]);
+
       current_step++;
       if (is_last_step())
       {
@@ -182,34 +180,9 @@ namespace gaspi
     template<typename T>
     void AllgathervLowLevel<T, AllgathervAlgorithm::RING>::copyOutImpl(void* outputs)
     {
-      auto head = static_cast<T*>(outputs);
-      if (number_ranks == 1)
-      {
-        std::copy(data_for_1rank_case.begin(), data_for_1rank_case.end(),
-                  head);
-      }
-      else
-      {
-        std::size_t send_index = rank.get();
-        std::size_t receive_index = group::decrementIndexOnRing(send_index, number_ranks);
-      
-        auto current_begin = head + offsets[send_index];
-        auto source_begin = static_cast<T*>(source_buffers[0]->address());
-        auto source_end = source_begin + counts[send_index];
-        std::copy(source_begin, source_end, current_begin);
-
-        for (auto i = 0UL; i < number_ranks - 1; ++i)
-        {
-          current_begin = head + offsets[receive_index];
-          source_begin = static_cast<T*>(target_buffers[i]->address());
-          source_end = source_begin + counts[receive_index];
-          std::copy(source_begin, source_end, current_begin);
-          receive_index = group::decrementIndexOnRing(receive_index, number_ranks);
-        }
-      }
+      std::copy(gathered_data.begin(), gathered_data.end(), static_cast<T*>(outputs));
     }
 
-
     template<typename T>
     bool AllgathervLowLevel<T, AllgathervAlgorithm::RING>::is_last_step() const
     {
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * AllreduceAuto.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AlgorithmSelection.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceHierarchical.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceRabenseifner.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceRecursiveDoubling.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceRing.hpp>
+
+#include <memory>
+#include <stdexcept>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // Environment variable overriding the selection table of the AUTO algorithm
+    inline constexpr char const* allreduce_selection_variable = "GASPICXX_ALLREDUCE_SELECTION";
+
+    // Default rules, favoring recursive doubling for latency-bound small
+    // messages, Rabenseifner's algorithm for medium-sized messages on larger
+    // groups, and the (bandwidth-optimal) ring otherwise
+    SelectionTable const& get_builtin_allreduce_selection_table();
+
+    // Selection table of the AUTO algorithm, taken from (in order of precedence)
+    //  - the environment variable `allreduce_selection_variable`,
+    //  - the runtime configuration (`RuntimeConfiguration::set_allreduce_selection`),
+    //  - the "allreduce" table of the tuning file (cf. `get_tuning_file`),
+    //  - the built-in rules
+    SelectionTable get_allreduce_selection_table();
+
+    AllreduceAlgorithm select_allreduce_algorithm(std::size_t number_ranks,
+                                                  std::size_t message_bytes);
+
+    // Dispatches at runtime to the algorithm selected for the group size and
+    // message size (`number_elements * sizeof(T)`).
+    // All ranks have to use the same selection table.
+    template<typename T>
+    class AllreduceLowLevel<T, AllreduceAlgorithm::AUTO> : public AllreduceCommon
+    {
+      public:
+        AllreduceLowLevel(gaspi::group::Group const& group,
+                          std::size_t number_elements,
+                          ReductionKernel<T> reduction_kernel);
+
+        void* getInPlaceBuffer() override;
+
+        AllreduceAlgorithm getSelectedAlgorithm() const;
+
+      private:
+        AllreduceAlgorithm selected_algorithm;
+        std::unique_ptr<AllreduceCommon> allreduce_impl;
+
+        void waitForSetupImpl() override;
+        void copyInImpl(void const*) override;
+        void copyOutImpl(void*) override;
+
+        void startImpl() override;
+        bool triggerProgressImpl() override;
+
+        static std::unique_ptr<AllreduceCommon> make_allreduce(AllreduceAlgorithm algorithm,
+                                                               gaspi::group::Group const& group,
+                                                               std::size_t number_elements,
+                                                               ReductionKernel<T> reduction_kernel);
+    };
+
+    template<typename T>
+    AllreduceLowLevel<T, AllreduceAlgorithm::AUTO>::AllreduceLowLevel(
+                      gaspi::group::Group const& group,
+                      std::size_t number_elements,
+                      ReductionKernel<T> reduction_kernel)
+    : AllreduceCommon(group, number_elements,
+                      reduction_kernel.get_untyped_kernel()),
+      selected_algorithm(select_allreduce_algorithm(group.size(),
+                                                    number_elements * sizeof(T))),
+      allreduce_impl(make_allreduce(selected_algorithm, group,
+                                    number_elements, reduction_kernel))
+    { }
+
+    template<typename T>
+    std::unique_ptr<AllreduceCommon> AllreduceLowLevel<T, AllreduceAlgorithm::AUTO>::make_allreduce(
+                      AllreduceAlgorithm algorithm,
+                      gaspi::group::Group const& group,
+                      std::size_t number_elements,
+                      ReductionKernel<T> reduction_kernel)
+    {
+      switch (algorithm)
+      {
+        case AllreduceAlgorithm::RING:
+        {
+          return std::make_unique<AllreduceLowLevel<T, AllreduceAlgorithm::RING>>(
+                   group, number_elements, reduction_kernel);
+        }
+        case AllreduceAlgorithm::RECURSIVE_DOUBLING:
+        {
+          return std::make_unique<AllreduceLowLevel<T, AllreduceAlgorithm::RECURSIVE_DOUBLING>>(
+                   group, number_elements, reduction_kernel);
+        }
+        case AllreduceAlgorithm::RABENSEIFNER:
+        {
+          return std::make_unique<AllreduceLowLevel<T, AllreduceAlgorithm::RABENSEIFNER>>(
+                   group, number_elements, reduction_kernel);
+        }
+        case AllreduceAlgorithm::HIERARCHICAL:
+        {
+          return std::make_unique<AllreduceLowLevel<T, AllreduceAlgorithm::HIERARCHICAL>>(
+                   group, number_elements, reduction_kernel);
+        }
+        default:
+        {
+          throw std::logic_error("AllreduceLowLevel<AUTO>: Algorithm " +
+                                 AllreduceInfo::names[algorithm] + " cannot be selected");
+        }
+      }
+    }
+
+    template<typename T>
+    void AllreduceLowLevel<T, AllreduceAlgorithm::AUTO>::waitForSetupImpl()
+    {
+      allreduce_impl->waitForSetup();
+    }
+
+    template<typename T>
+    void AllreduceLowLevel<T, AllreduceAlgorithm::AUTO>::startImpl()
+    {
+      allreduce_impl->start();
+    }
+
+    template<typename T>
+    bool AllreduceLowLevel<T, AllreduceAlgorithm::AUTO>::triggerProgressImpl()
+    {
+      return allreduce_impl->triggerProgress();
+    }
+
+    template<typename T>
+    void AllreduceLowLevel<T, AllreduceAlgorithm::AUTO>::copyInImpl(void const* inputs)
+    {
+      allreduce_impl->copyIn(inputs);
+    }
+
+    template<typename T>
+    void AllreduceLowLevel<T, AllreduceAlgorithm::AUTO>::copyOutImpl(void* outputs)
+    {
+      allreduce_impl->copyOut(outputs);
+    }
+
+    template<typename T>
+    void* AllreduceLowLevel<T, AllreduceAlgorithm::AUTO>::getInPlaceBuffer()
+    {
+      return allreduce_impl->getInPlaceBuffer();
+    }
+
+    template<typename T>
+    AllreduceAlgorithm AllreduceLowLevel<T, AllreduceAlgorithm::AUTO>::getSelectedAlgorithm() const
+    {
+      return selected_algorithm;
+    }
+  }
+}
@@ -22,24 +22,37 @@
 #pragma once
 
 #include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/CollectiveLowLevel.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/ReductionKernels.hpp>
 #include <GaspiCxx/group/Group.hpp>
 #include <GaspiCxx/singlesided/write/SourceBuffer.hpp>
 #include <GaspiCxx/singlesided/write/TargetBuffer.hpp>
 
 #include <array>
-#include <algorithm>
-#include <functional>
+#include <stdexcept>
+#include <utility>
 #include <unordered_map>
 
 namespace gaspi
 {
   namespace collectives
   {
-    // FIXME: Support the same Operations as MPI
+    // Reduction operations, following the predefined operations of MPI
+    //
+    // MINLOC and MAXLOC require `ValueLocation` elements, and the bitwise
+    // operations integral elements.
     enum class ReductionOp
     {
       PROD,
       SUM,
+      MIN,
+      MAX,
+      MINLOC,
+      MAXLOC,
+      BAND,
+      BOR,
+      BXOR,
+      LAND,
+      LOR,
     };
 
     class AllreduceInfo
@@ -49,55 +62,211 @@ namespace gaspi
         {
           RING,
           RECURSIVE_DOUBLING,
+          RABENSEIFNER,
+          HIERARCHICAL,
+          COMPRESSED_RING,
+          AUTO,
         };
         static inline std::unordered_map<Algorithm, std::string> names
                       { {Algorithm::RING, "ring" },
-                        {Algorithm::RECURSIVE_DOUBLING, "recursivedoubling" } };
-        static inline constexpr std::array<Algorithm, 2> implemented
-                      { Algorithm::RING, Algorithm::RECURSIVE_DOUBLING };
+                        {Algorithm::RECURSIVE_DOUBLING, "recursivedoubling" },
+                        {Algorithm::RABENSEIFNER, "rabenseifner" },
+                        {Algorithm::HIERARCHICAL, "hierarchical" },
+                        {Algorithm::COMPRESSED_RING, "compressedring" },
+                        {Algorithm::AUTO, "auto" } };
+        // Algorithms computing exact results for all element types
+        // (COMPRESSED_RING is lossy and restricted to floating point data)
+        static inline constexpr std::array<Algorithm, 5> implemented
+                      { Algorithm::RING, Algorithm::RECURSIVE_DOUBLING,
+                        Algorithm::RABENSEIFNER, Algorithm::HIERARCHICAL,
+                        Algorithm::AUTO };
     };
     using AllreduceAlgorithm = AllreduceInfo::Algorithm;
 
+    // Selects the reduction kernel for the given element type and operation
+    template<typename T>
+    reduction::Kernel get_reduction_kernel(ReductionOp reduction_op)
+    {
+      reduction::Kernel kernel = nullptr;
+      switch (reduction_op)
+      {
+        case ReductionOp::PROD:
+        {
+          kernel = reduction::get_kernel<T, reduction::Prod>();
+          break;
+        }
+        case ReductionOp::SUM:
+        {
+          kernel = reduction::get_kernel<T, reduction::Sum>();
+          break;
+        }
+        case ReductionOp::MIN:
+        {
+          kernel = reduction::get_kernel<T, reduction::Min>();
+          break;
+        }
+        case ReductionOp::MAX:
+        {
+          kernel = reduction::get_kernel<T, reduction::Max>();
+          break;
+        }
+        case ReductionOp::MINLOC:
+        {
+          kernel = reduction::get_kernel<T, reduction::MinLocation>();
+          break;
+        }
+        case ReductionOp::MAXLOC:
+        {
+          kernel = reduction::get_kernel<T, reduction::MaxLocation>();
+          break;
+        }
+        case ReductionOp::BAND:
+        {
+          kernel = reduction::get_kernel<T, reduction::BitwiseAnd>();
+          break;
+        }
+        case ReductionOp::BOR:
+        {
+          kernel = reduction::get_kernel<T, reduction::BitwiseOr>();
+          break;
+        }
+        case ReductionOp::BXOR:
+        {
+          kernel = reduction::get_kernel<T, reduction::BitwiseXor>();
+          break;
+        }
+        case ReductionOp::LAND:
+        {
+          kernel = reduction::get_kernel<T, reduction::LogicalAnd>();
+          break;
+        }
+        case ReductionOp::LOR:
+        {
+          kernel = reduction::get_kernel<T, reduction::LogicalOr>();
+          break;
+        }
+      }
+
+      if (kernel == nullptr)
+      {
+        throw std::logic_error(
+          "get_reduction_kernel: Reduction operation not supported for this element type");
+      }
+      return kernel;
+    }
+
+    // Reduction applied by an Allreduce on elements of type `T`,
+    // either one of the predefined operations or a user-defined one.
+    //
+    // User-defined operations have to be commutative and associative,
+    // as the order in which contributions are combined depends on
+    // the algorithm.
+    template<typename T>
+    class ReductionKernel
+    {
+      public:
+        ReductionKernel(ReductionOp reduction_op);
+
+        // Element-wise operation `T binary_op(T const&, T const&)`
+        template<typename BinaryOp>
+        static ReductionKernel elementwise(BinaryOp binary_op);
+
+        // Operation on whole spans of elements
+        // `void span_op(T* inouts, T const* inputs, std::size_t number_elements)`,
+        // which reduces `inputs` into `inouts` (e.g., a vectorized kernel)
+        template<typename SpanOp>
+        static ReductionKernel spanwise(SpanOp span_op);
+
+        reduction::Kernel const& get_untyped_kernel() const;
+
+      private:
+        explicit ReductionKernel(reduction::Kernel kernel);
+
+        reduction::Kernel kernel;
+    };
+
+    template<typename T>
+    ReductionKernel<T>::ReductionKernel(ReductionOp reduction_op)
+    : kernel(get_reduction_kernel<T>(reduction_op))
+    { }
+
+    template<typename T>
+    ReductionKernel<T>::ReductionKernel(reduction::Kernel kernel)
+    : kernel(std::move(kernel))
+    { }
+
+    template<typename T>
+    template<typename BinaryOp>
+    ReductionKernel<T> ReductionKernel<T>::elementwise(BinaryOp binary_op)
+    {
+      return ReductionKernel(
+        [binary_op](void* inouts, void const* inputs, std::size_t number_elements)
+        {
+          auto const inouts_begin = static_cast<T*>(inouts);
+          auto const inputs_begin = static_cast<T const*>(inputs);
+          for (auto i = 0UL; i < number_elements; ++i)
+          {
+            inouts_begin[i] = binary_op(inouts_begin[i], inputs_begin[i]);
+          }
+        });
+    }
+
+    template<typename T>
+    template<typename SpanOp>
+    ReductionKernel<T> ReductionKernel<T>::spanwise(SpanOp span_op)
+    {
+      return ReductionKernel(
+        [span_op](void* inouts, void const* inputs, std::size_t number_elements)
+        {
+          span_op(static_cast<T*>(inouts), static_cast<T const*>(inputs),
+                  number_elements);
+        });
+    }
+
+    template<typename T>
+    reduction::Kernel const& ReductionKernel<T>::get_untyped_kernel() const
+    {
+      return kernel;
+    }
+
     class AllreduceCommon : public CollectiveLowLevel
     {
       public:
         AllreduceCommon(gaspi::group::Group const& group,
                         std::size_t number_elements,
-                        ReductionOp reduction_op);
+                        reduction::Kernel reduction_kernel);
         virtual ~AllreduceCommon() = default;
         std::size_t getOutputCount() override;
 
+        // In-place mode
+        // =============
+        // Segment memory the algorithm sends from and reduces into, holding
+        // `getOutputCount()` elements (possibly followed by padding).
+        // Calling `copyIn`/`copyOut` with this buffer skips the copies,
+        // i.e., inputs written to it are used directly, and it contains
+        // the results once the collective has finished.
+        // Its contents are undefined while the collective is running.
+        virtual void* getInPlaceBuffer() = 0;
+
       protected:
         gaspi::group::Group group;
         std::size_t number_elements;
-        ReductionOp reduction_op;
+        reduction::Kernel reduction_kernel;
 
         template<typename T>
         void apply_reduce_op(gaspi::singlesided::write::SourceBuffer& source_comm,
                              gaspi::singlesided::write::TargetBuffer& target_comm)
         {
-          auto const source_begin = static_cast<T*>(source_comm.address());
-          auto const source_end = source_begin +
-                                  source_comm.description().size()/sizeof(T);
-          auto const target_begin = static_cast<T*>(target_comm.address());
-
-          std::function<T(T const&, T const&)> reduction_functor;
-          switch (reduction_op)
-          {
-            case ReductionOp::PROD:
-            {
-              reduction_functor = std::multiplies<T>();
-              break;
-            }
-            case ReductionOp::SUM:
-            {
-              reduction_functor = std::plus<T>();
-              break;
-            }
-          }
+          apply_reduce_op<T>(static_cast<T*>(source_comm.address()),
+                             static_cast<T const*>(target_comm.address()),
+                             source_comm.description().size()/sizeof(T));
+        }
 
-          std::transform(source_begin, source_end, target_begin,
-                         source_begin, reduction_functor);
+        // Reduces `number_elements` values from `inputs` into `inouts`
+        template<typename T>
+        void apply_reduce_op(T* inouts, T const* inputs, std::size_t number_elements)
+        {
+          reduction_kernel(inouts, inputs, number_elements);
         }
     };
 
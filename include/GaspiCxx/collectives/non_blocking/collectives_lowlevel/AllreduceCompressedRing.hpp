@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * AllreduceCompressedRing.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/group/Utilities.hpp>
+#include <GaspiCxx/singlesided/write/SourceBuffer.hpp>
+#include <GaspiCxx/singlesided/write/TargetBuffer.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/CollectiveLowLevel.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/Compression.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/Utilities.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // Runtime settings of the COMPRESSED_RING algorithm
+    struct AllreduceCompressedRingSettings
+    {
+      static inline Compression compression { CompressionMethod::QUANTIZATION_8BIT,
+                                              0.01, 256 };
+    };
+
+    // Ring algorithm that transfers compressed blocks, i.e., the results
+    // are approximations, meant for sums of floating point data
+    // (e.g., gradients).
+    //
+    // Blocks are recompressed after each reduction, and the owner of
+    // a fully reduced block compresses it once more for the gather stage,
+    // where its payload is forwarded unchanged, such that all ranks obtain
+    // the same results.
+    // Error feedback: each rank keeps the compression errors of the blocks
+    // it sent, and adds them to its inputs of the next run.
+    template<typename T>
+    class AllreduceLowLevel<T, AllreduceAlgorithm::COMPRESSED_RING> : public AllreduceCommon
+    {
+      using SourceBuffer = gaspi::singlesided::write::SourceBuffer;
+      using TargetBuffer = gaspi::singlesided::write::TargetBuffer;
+      using ConnectHandle = gaspi::singlesided::Endpoint::ConnectHandle;
+
+      public:
+        using AllreduceCommon::AllreduceCommon;
+
+        AllreduceLowLevel(gaspi::group::Group const& group,
+                          std::size_t number_elements,
+                          ReductionKernel<T> reduction_kernel,
+                          Compression const& compression = AllreduceCompressedRingSettings::compression);
+
+        // Not segment memory, as only the compressed payloads are transferred
+        void* getInPlaceBuffer() override;
+
+      private:
+        enum class RingStage
+        {
+          REDUCE,
+          GATHER
+        };
+
+        std::size_t number_ranks;
+        gaspi::group::Rank rank;
+        gaspi::group::Rank left_neighbor;
+        gaspi::group::Rank right_neighbor;
+        std::size_t number_elements_block;
+        Compressor<T> compressor;
+
+        // all blocks (padded), and the errors of their last compression
+        std::vector<T> data;
+        std::vector<T> residuals;
+        std::vector<T> decompressed_block;
+
+        // one payload buffer per step; sources of forwarded payloads
+        // alias the targets they were received into
+        std::vector<std::unique_ptr<SourceBuffer>> source_buffers;
+        std::vector<std::unique_ptr<TargetBuffer>> target_buffers;
+        std::vector<ConnectHandle> handles;
+
+        std::size_t current_step;
+        std::size_t steps_per_stage;
+        gaspi::group::RingIndex current_index;
+
+        void waitForSetupImpl() override;
+        void copyInImpl(void const*) override;
+        void copyOutImpl(void*) override;
+
+        void startImpl() override;
+        bool triggerProgressImpl() override;
+
+        // algorithm-specific methods
+        auto algorithm_get_current_stage() const;
+        bool is_last_step_reduce() const;
+        bool is_last_step_gather() const;
+        bool is_last_step() const;
+
+        T* get_block_begin(std::size_t block);
+        void start_compressed_transfer(std::size_t step, std::size_t block);
+    };
+
+    template<typename T>
+    AllreduceLowLevel<T, AllreduceAlgorithm::COMPRESSED_RING>::AllreduceLowLevel(
+                      gaspi::group::Group const& group,
+                      std::size_t number_elements,
+                      ReductionKernel<T> reduction_kernel,
+                      Compression const& compression)
+    : AllreduceCommon(group, number_elements,
+                      reduction_kernel.get_untyped_kernel()),
+      number_ranks(group.size()),
+      rank(group.rank()),
+      left_neighbor(group::decrementRankOnRing(rank, number_ranks)),
+      right_neighbor(group::incrementRankOnRing(rank, number_ranks)),
+      number_elements_block(ceil_div(number_elements, number_ranks)),
+      compressor(compression, number_elements_block, rank.get() + 1),
+      data(number_elements_block * number_ranks),
+      residuals(number_elements_block * number_ranks),
+      decompressed_block(number_elements_block),
+      source_buffers(),
+      target_buffers(),
+      handles(),
+      current_step(0),
+      steps_per_stage(number_ranks-1),
+      current_index(rank.get(), number_ranks)
+    {
+      if (number_elements > 0 && number_ranks > 1)
+      {
+        auto const number_steps = 2 * steps_per_stage;
+        auto const size_payload = compressor.get_max_payload_size();
+        std::vector<segment::Segment*> target_segments;
+        for (auto step = 0UL; step < number_steps; ++step)
+        {
+          // the first gather step sends the owned block, all further
+          // ones forward the payload received in the previous step
+          if (step <= steps_per_stage)
+          {
+            source_buffers.push_back(std::make_unique<SourceBuffer>(size_payload));
+          }
+          else
+          {
+            source_buffers.push_back(std::make_unique<SourceBuffer>(
+              target_buffers[step - 1]->address(), *target_segments[step - 1], size_payload));
+          }
+
+          target_segments.push_back(&gaspi::getRuntime().getFreeSegment(size_payload));
+          target_buffers.push_back(std::make_unique<TargetBuffer>(*target_segments.back(),
+                                                                  size_payload));
+        }
+
+        for (auto step = 0UL; step < number_steps; ++step)
+        {
+          SourceBuffer::Tag const source_tag = step;
+          TargetBuffer::Tag const target_tag = step;
+          handles.push_back(source_buffers[step]->connectToRemoteTarget(
+            group, right_neighbor, source_tag));
+          handles.push_back(target_buffers[step]->connectToRemoteSource(
+            group, left_neighbor, target_tag));
+        }
+      }
+    }
+
+    template<typename T>
+    void AllreduceLowLevel<T, AllreduceAlgorithm::COMPRESSED_RING>::waitForSetupImpl()
+    {
+      for (auto& handle : handles)
+      {
+        handle.waitForCompletion();
+      }
+    }
+
+    template<typename T>
+    void AllreduceLowLevel<T, AllreduceAlgorithm::COMPRESSED_RING>::startImpl()
+    {
+      if (number_elements > 0 && number_ranks > 1)
+      {
+        current_step = 0;
+        current_index = group::RingIndex(rank.get(), number_ranks);
+        start_compressed_transfer(current_step, current_index);
+        current_index--;
+      }
+    }
+
+    template<typename T>
+    bool AllreduceLowLevel<T, AllreduceAlgorithm::COMPRESSED_RING>::triggerProgressImpl()
+    {
+      if (number_elements == 0 || number_ranks == 1) { return true; }
+
+      if (is_last_step()) // wait for final transfer acknowledgement
+      {
+        return source_buffers.back()->checkForTransferAck();
+      }
+
+      auto& target_buffer = *target_buffers[current_step];
+      if (!target_buffer.checkForCompletion()) { return false; }
+
+      switch(algorithm_get_current_stage())
+      {
+        case RingStage::REDUCE:
+        {
+          compressor.decompress(target_buffer.address(), decompressed_block.data());
+          apply_reduce_op<T>(get_block_begin(current_index), decompressed_block.data(),
+                             number_elements_block);
+          start_compressed_transfer(current_step + 1, current_index);
+          if (is_last_step_reduce())
+          {
+            // keep the same approximation of the owned block as all other ranks
+            compressor.decompress(source_buffers[current_step + 1]->address(),
+                                  get_block_begin(current_index));
+          }
+          break;
+        }
+        case RingStage::GATHER:
+        {
+          compressor.decompress(target_buffer.address(), get_block_begin(current_index));
+          if (!is_last_step_gather())
+          {
+            source_buffers[current_step + 1]->initTransferPart(
+              compressor.get_payload_size(target_buffer.address()), 0);
+          }
+          else
+          {
+            target_buffer.ackTransfer();
+          }
+        }
+      }
+
+      current_step++;
+      current_index--;
+      return false;
+    }
+
+    template<typename T>
+    void AllreduceLowLevel<T, AllreduceAlgorithm::COMPRESSED_RING>::copyInImpl(void const* inputs)
+    {
+      if (inputs != getInPlaceBuffer())
+      {
+        auto const begin = static_cast<T const*>(inputs);
+        std::copy(begin, begin + number_elements, data.begin());
+      }
+      std::fill(data.begin() + number_elements, data.end(), T(0));
+
+      // error feedback from the previous run
+      std::transform(data.begin(), data.begin() + number_elements, residuals.begin(),
+                     data.begin(), std::plus<T>());
+      std::fill(residuals.begin(), residuals.end(), T(0));
+    }
+
+    template<typename T>
+    void AllreduceLowLevel<T, AllreduceAlgorithm::COMPRESSED_RING>::copyOutImpl(void* outputs)
+    {
+      if (outputs == getInPlaceBuffer()) { return; }
+
+      std::copy(data.begin(), data.begin() + number_elements, static_cast<T*>(outputs));
+    }
+
+    template<typename T>
+    void* AllreduceLowLevel<T, AllreduceAlgorithm::COMPRESSED_RING>::getInPlaceBuffer()
+    {
+      return data.data();
+    }
+
+    template<typename T>
+    auto AllreduceLowLevel<T, AllreduceAlgorithm::COMPRESSED_RING>::algorithm_get_current_stage() const
+    {
+      return current_step / steps_per_stage == 0 ? RingStage::REDUCE : RingStage::GATHER;
+    }
+
+    template<typename T>
+    bool AllreduceLowLevel<T, AllreduceAlgorithm::COMPRESSED_RING>::is_last_step_reduce() const
+    {
+      return current_step == steps_per_stage - 1;
+    }
+
+    template<typename T>
+    bool AllreduceLowLevel<T, AllreduceAlgorithm::COMPRESSED_RING>::is_last_step_gather() const
+    {
+      return current_step == 2 * steps_per_stage - 1;
+    }
+
+    template<typename T>
+    bool AllreduceLowLevel<T, AllreduceAlgorithm::COMPRESSED_RING>::is_last_step() const
+    {
+      return current_step == 2 * steps_per_stage;
+    }
+
+    template<typename T>
+    T* AllreduceLowLevel<T, AllreduceAlgorithm::COMPRESSED_RING>::get_block_begin(
+                  std::size_t block)
+    {
+      return data.data() + block * number_elements_block;
+    }
+
+    // Sends a payload of variable size to the beginning of the remote target
+    template<typename T>
+    void AllreduceLowLevel<T, AllreduceAlgorithm::COMPRESSED_RING>::start_compressed_transfer(
+                  std::size_t step, std::size_t block)
+    {
+      auto& source_buffer = *source_buffers[step];
+      auto const size_payload = compressor.compress(get_block_begin(block),
+                                                    residuals.data() + block * number_elements_block,
+                                                    source_buffer.address());
+      source_buffer.initTransferPart(size_payload, 0);
+    }
+  }
+}
@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * AllreduceHierarchical.hpp
+ *
+ */
+
+
+#pragma once
+
+#include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/group/Group.hpp>
+#include <GaspiCxx/singlesided/write/SourceBuffer.hpp>
+#include <GaspiCxx/singlesided/write/TargetBuffer.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/CollectiveLowLevel.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceRing.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/NodeMapping.hpp>
+
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    /*
+     * HIERARCHICAL (NODE-AWARE)
+     * =========================
+     *
+     * Two-level algorithm for groups spanning several compute nodes,
+     * which only communicates across nodes among one leader rank per node.
+     *
+     * Steps:
+     *
+     *   1. The ranks on each node send their input vector to the node leader
+     *      (i.e., the lowest rank on the node), which reduces them with its own.
+     *   2. The node leaders compute an allreduce among themselves (RING algorithm).
+     *   3. The node leaders send the result to the other ranks on their node.
+     *
+     * The number of steps across the network thus scales with the number of
+     * nodes rather than the number of ranks.
+     * The node of each rank is derived from its host name, unless specified
+     * explicitly.
+     */
+    template<typename T>
+    class AllreduceLowLevel<T, AllreduceAlgorithm::HIERARCHICAL> : public AllreduceCommon
+    {
+      using SourceBuffer = gaspi::singlesided::write::SourceBuffer;
+      using TargetBuffer = gaspi::singlesided::write::TargetBuffer;
+      using ConnectHandle = gaspi::singlesided::Endpoint::ConnectHandle;
+      using AllreduceLeaders = AllreduceLowLevel<T, AllreduceAlgorithm::RING>;
+
+      public:
+        using AllreduceCommon::AllreduceCommon;
+
+        AllreduceLowLevel(gaspi::group::Group const& group,
+                          std::size_t number_elements,
+                          ReductionKernel<T> reduction_kernel);
+
+        // `node_ids` assigns a node to each rank of the `group`
+        AllreduceLowLevel(gaspi::group::Group const& group,
+                          std::size_t number_elements,
+                          ReductionKernel<T> reduction_kernel,
+                          std::vector<std::size_t> const& node_ids);
+
+        void* getInPlaceBuffer() override;
+
+      private:
+        enum class AlgStage
+        {
+          REDUCE_NODE,
+          ALLREDUCE_LEADERS,
+          BROADCAST_NODE,
+        };
+
+        gaspi::group::Rank rank;
+        std::size_t size_buffer_bytes;
+        // ranks on the same node, starting with the node leader
+        std::vector<gaspi::group::Rank> node_ranks;
+
+        std::unique_ptr<SourceBuffer> data_buffer;
+        // node leader: one buffer per other rank on the node
+        std::vector<std::unique_ptr<TargetBuffer>> target_buffers_reduce;
+        std::vector<std::unique_ptr<SourceBuffer>> source_buffers_broadcast;
+        // other ranks: receive the result into `data_buffer`
+        std::unique_ptr<TargetBuffer> target_buffer_broadcast;
+        // node leaders of a group spanning several nodes
+        std::unique_ptr<AllreduceLeaders> allreduce_leaders;
+
+        std::vector<ConnectHandle> handles;
+        std::size_t current_index;
+        AlgStage alg_stage;
+
+        void waitForSetupImpl() override;
+        void copyInImpl(void const*) override;
+        void copyOutImpl(void*) override;
+
+        void startImpl() override;
+        bool triggerProgressImpl() override;
+
+        // algorithm-specific methods
+        bool is_leader() const;
+    };
+
+    template<typename T>
+    AllreduceLowLevel<T, AllreduceAlgorithm::HIERARCHICAL>::AllreduceLowLevel(
+                      gaspi::group::Group const& group,
+                      std::size_t number_elements,
+                      ReductionKernel<T> reduction_kernel)
+    : AllreduceLowLevel(group, number_elements, reduction_kernel, get_node_ids(group))
+    { }
+
+    template<typename T>
+    AllreduceLowLevel<T, AllreduceAlgorithm::HIERARCHICAL>::AllreduceLowLevel(
+                      gaspi::group::Group const& group,
+                      std::size_t number_elements,
+                      ReductionKernel<T> reduction_kernel,
+                      std::vector<std::size_t> const& node_ids)
+    : AllreduceCommon(group, number_elements,
+                      reduction_kernel.get_untyped_kernel()),
+      rank(group.rank()),
+      size_buffer_bytes(sizeof(T) * number_elements),
+      node_ranks(),
+      data_buffer(),
+      target_buffers_reduce(), source_buffers_broadcast(),
+      target_buffer_broadcast(),
+      allreduce_leaders(),
+      handles(),
+      current_index(0),
+      alg_stage(AlgStage::REDUCE_NODE)
+    {
+      if (node_ids.size() != group.size())
+      {
+        throw std::logic_error(
+          "AllreduceLowLevel: Node mapping does not match the group size");
+      }
+
+      std::vector<gaspi::group::GlobalRank> leaders;
+      std::vector<bool> is_node_with_leader;
+      for (auto i = 0UL; i < group.size(); ++i)
+      {
+        auto const node_id = node_ids[i];
+        if (node_id >= is_node_with_leader.size())
+        {
+          is_node_with_leader.resize(node_id + 1, false);
+        }
+        if (!is_node_with_leader[node_id])
+        {
+          is_node_with_leader[node_id] = true;
+          leaders.push_back(group.toGlobalRank(gaspi::group::Rank(i)));
+        }
+        if (node_id == node_ids[rank.get()])
+        {
+          node_ranks.push_back(gaspi::group::Rank(i));
+        }
+      }
+
+      if (number_elements == 0) { return; }
+
+      auto& segment = gaspi::getRuntime().getFreeSegment(size_buffer_bytes);
+      data_buffer = std::make_unique<SourceBuffer>(segment, size_buffer_bytes);
+
+      auto const source_tag_reduce = SourceBuffer::Tag(0);
+      auto const target_tag_reduce = TargetBuffer::Tag(0);
+      auto const source_tag_broadcast = SourceBuffer::Tag(1);
+      auto const target_tag_broadcast = TargetBuffer::Tag(1);
+      if (is_leader())
+      {
+        for (auto i = 1UL; i < node_ranks.size(); ++i)
+        {
+          target_buffers_reduce.push_back(std::make_unique<TargetBuffer>(size_buffer_bytes));
+          source_buffers_broadcast.push_back(std::make_unique<SourceBuffer>(*data_buffer));
+          handles.push_back(
+            target_buffers_reduce.back()->connectToRemoteSource(group, node_ranks[i],
+                                                                target_tag_reduce));
+          handles.push_back(
+            source_buffers_broadcast.back()->connectToRemoteTarget(group, node_ranks[i],
+                                                                   source_tag_broadcast));
+        }
+
+        if (leaders.size() > 1)
+        {
+          allreduce_leaders = std::make_unique<AllreduceLeaders>(
+            gaspi::group::Group(leaders), number_elements, reduction_kernel);
+        }
+      }
+      else
+      {
+        // The result is received into the input buffer, which is safe as the
+        // leader sends it only after having received the input
+        target_buffer_broadcast = std::make_unique<TargetBuffer>(
+          data_buffer->address(), segment, size_buffer_bytes);
+        handles.push_back(
+          data_buffer->connectToRemoteTarget(group, node_ranks.front(), source_tag_reduce));
+        handles.push_back(
+          target_buffer_broadcast->connectToRemoteSource(group, node_ranks.front(),
+                                                         target_tag_broadcast));
+      }
+    }
+
+    template<typename T>
+    void AllreduceLowLevel<T, AllreduceAlgorithm::HIERARCHICAL>::waitForSetupImpl()
+    {
+      for (auto& handle : handles)
+      {
+        handle.waitForCompletion();
+      }
+      if (allreduce_leaders)
+      {
+        allreduce_leaders->waitForSetup();
+      }
+    }
+
+    template<typename T>
+    void AllreduceLowLevel<T, AllreduceAlgorithm::HIERARCHICAL>::startImpl()
+    {
+      if (number_elements == 0) { return; }
+
+      current_index = 0;
+      alg_stage = AlgStage::REDUCE_NODE;
+      if (!is_leader())
+      {
+        data_buffer->initTransfer();
+      }
+    }
+
+    template<typename T>
+    bool AllreduceLowLevel<T, AllreduceAlgorithm::HIERARCHICAL>::triggerProgressImpl()
+    {
+      if (number_elements == 0) { return true; }
+
+      if (!is_leader())
+      {
+        if (!target_buffer_broadcast->checkForCompletion()) { return false; }
+        target_buffer_broadcast->ackTransfer();
+        return true;
+      }
+
+      if (alg_stage == AlgStage::REDUCE_NODE)
+      {
+        while (current_index < target_buffers_reduce.size())
+        {
+          auto& target_buffer = *target_buffers_reduce[current_index];
+          if (!target_buffer.checkForCompletion()) { return false; }
+
+          apply_reduce_op<T>(*data_buffer, target_buffer);
+          current_index++;
+        }
+
+        if (allreduce_leaders)
+        {
+          allreduce_leaders->copyIn(data_buffer->address());
+          allreduce_leaders->start();
+        }
+        alg_stage = AlgStage::ALLREDUCE_LEADERS;
+      }
+
+      if (alg_stage == AlgStage::ALLREDUCE_LEADERS)
+      {
+        if (allreduce_leaders)
+        {
+          if (!allreduce_leaders->triggerProgress()) { return false; }
+          allreduce_leaders->copyOut(data_buffer->address());
+        }
+
+        for (auto& source_buffer : source_buffers_broadcast)
+        {
+          source_buffer->initTransfer();
+        }
+        current_index = 0;
+        alg_stage = AlgStage::BROADCAST_NODE;
+      }
+
+      // wait for final transfer acknowledgements
+      while (current_index < source_buffers_broadcast.size())
+      {
+        if (!source_buffers_broadcast[current_index]->checkForTransferAck()) { return false; }
+        current_index++;
+      }
+      return true;
+    }
+
+    template<typename T>
+    void AllreduceLowLevel<T, AllreduceAlgorithm::HIERARCHICAL>::copyInImpl(void const* inputs)
+    {
+      if (number_elements == 0 || inputs == getInPlaceBuffer()) { return; }
+      std::memcpy(getInPlaceBuffer(), inputs, size_buffer_bytes);
+    }
+
+    template<typename T>
+    void AllreduceLowLevel<T, AllreduceAlgorithm::HIERARCHICAL>::copyOutImpl(void* outputs)
+    {
+      if (number_elements == 0 || outputs == getInPlaceBuffer()) { return; }
+      std::memcpy(outputs, getInPlaceBuffer(), size_buffer_bytes);
+    }
+
+    template<typename T>
+    void* AllreduceLowLevel<T, AllreduceAlgorithm::HIERARCHICAL>::getInPlaceBuffer()
+    {
+      return number_elements == 0 ? nullptr : data_buffer->address();
+    }
+
+    template<typename T>
+    bool AllreduceLowLevel<T, AllreduceAlgorithm::HIERARCHICAL>::is_leader() const
+    {
+      return node_ranks.front() == rank;
+    }
+  }
+}
@@ -0,0 +1,570 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * AllreduceRabenseifner.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/group/Utilities.hpp>
+#include <GaspiCxx/singlesided/write/SourceBuffer.hpp>
+#include <GaspiCxx/singlesided/write/TargetBuffer.hpp>
+#include <GaspiCxx/singlesided/BufferDescription.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/CollectiveLowLevel.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/Utilities.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    /*
+     * RABENSEIFNER (REDUCE-SCATTER + ALLGATHER)
+     * =========================================
+     *
+     * Implemented as described Section 2.5 (p.4, cf. also Fig.2) in
+     *
+     *   Rabenseifner, R. (2004, June).
+     *   Optimization of collective reduction operations.
+     *   In International Conference on Computational Science (pp. 1-9).
+     *   Springer, Berlin, Heidelberg.
+     *
+     * This algorithm is particularly performant for large message sizes,
+     * as each rank only sends and receives about 2*(p'-1)/p' times the
+     * input vector, while keeping the logarithmic number of steps of
+     * recursive doubling.
+     *
+     *
+     * Description:
+     * ------------
+     *
+     *   The handling of the non-power-of-two case, the nomenclature and the
+     *   relabelling of the active ranks are the same as for the
+     *   RECURSIVE_DOUBLING algorithm.
+     *
+     *   The input vector is padded and split into p' blocks of equal size.
+     *
+     *   Steps:
+     *
+     *     1. Non-active ranks send their input vector to their respective active partner
+     *        (a.k.a. "even non-extra rank"), who reduces it with its own input vector.
+     *     2. Reduce-scatter by recursive halving, in (log p') iterations:
+     *        Pairs of ranks separated by a distance that halves every iteration
+     *        (start distance: p'/2), exchange one half of their current window of blocks.
+     *        Each rank keeps and reduces the half that contains its own block.
+     *        Afterwards, relabelled rank j holds the fully reduced block j.
+     *     3. Allgather by recursive doubling, in (log p') iterations:
+     *        Pairs of ranks separated by a distance that doubles every iteration
+     *        (start distance: 1), exchange their current window of reduced blocks,
+     *        which doubles the window size.
+     *     4. Final result is send from even non-extra rank back to their respective
+     *        non-active partner.
+     *
+     *   Example (4 ranks, blocks A-D):
+     *
+     *     Initial state:
+     *       rank         0          1          2          3
+     *       input   [A B C D]  [A B C D]  [A B C D]  [A B C D]
+     *
+     *     Iteration 0 (step 2, distance 2):
+     *       rank         0          1          2          3
+     *       reduced [A B - -]  [A B - -]  [- - C D]  [- - C D]
+     *                (0,2)      (1,3)      (0,2)      (1,3)
+     *
+     *     Iteration 1 (step 2, distance 1):
+     *       rank         0          1          2          3
+     *       reduced [A - - -]  [- B - -]  [- - C -]  [- - - D]
+     *                (0-3)      (0-3)      (0-3)      (0-3)
+     *
+     *     Iteration 0 (step 3, distance 1):
+     *       rank         0          1          2          3
+     *       result  [A B - -]  [A B - -]  [- - C D]  [- - C D]
+     *
+     *     Iteration 1 (step 3, distance 2):
+     *       rank         0          1          2          3
+     *       result  [A B C D]  [A B C D]  [A B C D]  [A B C D]
+     */
+    template<typename T>
+    class AllreduceLowLevel<T, AllreduceAlgorithm::RABENSEIFNER> : public AllreduceCommon
+    {
+      using SourceBuffer = gaspi::singlesided::write::SourceBuffer;
+      using TargetBuffer = gaspi::singlesided::write::TargetBuffer;
+      using ConnectHandle = gaspi::singlesided::Endpoint::ConnectHandle;
+
+      public:
+        using AllreduceCommon::AllreduceCommon;
+
+        AllreduceLowLevel(gaspi::group::Group const& group,
+                          std::size_t number_elements,
+                          ReductionKernel<T> reduction_kernel);
+
+        void* getInPlaceBuffer() override;
+
+      private:
+        enum class AlgStage
+        {
+          NOT_STARTED,
+          INITIAL_STEP_NON_POWER_TWO,
+          REDUCE_SCATTER,
+          ALLGATHER,
+          WAIT_FOR_ACK,
+          FINAL_STEP_NON_POWER_TWO,
+        };
+
+        std::size_t number_ranks;
+        std::size_t number_ranks_used;
+        std::size_t number_ranks_rest;
+        gaspi::group::Rank rank;
+        std::size_t relabeled_rank;
+
+        std::size_t number_elements_block;
+        std::size_t size_block_bytes;
+        std::size_t size_buffer_bytes;
+
+        std::unique_ptr<SourceBuffer> work_buffer;
+        std::vector<std::unique_ptr<SourceBuffer>> source_buffers_reduce_scatter;
+        std::vector<std::unique_ptr<TargetBuffer>> target_buffers_reduce_scatter;
+        std::vector<std::unique_ptr<SourceBuffer>> source_buffers_allgather;
+        std::vector<std::unique_ptr<TargetBuffer>> target_buffers_allgather;
+        std::unique_ptr<SourceBuffer> source_buffer_non_power_two_case;
+        std::unique_ptr<TargetBuffer> target_buffer_non_power_two_case;
+
+        std::vector<ConnectHandle> handles;
+        std::vector<T> data_for_1rank_case;
+
+        std::size_t iteration;
+        std::size_t number_iterations;
+
+        AlgStage alg_stage;
+
+        void waitForSetupImpl() override;
+        void copyInImpl(void const*) override;
+        void copyOutImpl(void*) override;
+
+        void startImpl() override;
+        bool triggerProgressImpl() override;
+
+        // algorithm-specific methods
+        bool is_extra_rank() const;
+        bool is_non_extra_rank() const;
+        bool is_even_non_extra_rank() const;
+        bool is_odd_non_extra_rank() const;
+        bool is_active_rank() const;
+        bool is_last_iteration() const;
+
+        gaspi::group::Rank get_neighbor(std::size_t distance) const;
+        std::size_t get_reduce_scatter_distance(std::size_t iteration) const;
+        std::size_t get_reduce_scatter_send_block(std::size_t iteration) const;
+        std::size_t get_reduce_scatter_keep_block(std::size_t iteration) const;
+        std::size_t get_allgather_distance(std::size_t iteration) const;
+        std::size_t get_allgather_window_block(std::size_t window_owner,
+                                               std::size_t iteration) const;
+
+        void start_reduce_scatter_iteration();
+        void start_allgather_iteration();
+    };
+
+    template<typename T>
+    AllreduceLowLevel<T, AllreduceAlgorithm::RABENSEIFNER>::AllreduceLowLevel(
+                      gaspi::group::Group const& group,
+                      std::size_t number_elements,
+                      ReductionKernel<T> reduction_kernel)
+    : AllreduceCommon(group, number_elements,
+                      reduction_kernel.get_untyped_kernel()),
+      number_ranks(group.size()),
+      number_ranks_used(nearest_power_of_two_less_equal(number_ranks)),
+      number_ranks_rest(number_ranks - number_ranks_used),
+      rank(group.rank()),
+      relabeled_rank(rank.get() < 2 * number_ranks_rest ?
+                       rank.get() / 2 : rank.get() - number_ranks_rest),
+      number_elements_block(ceil_div(number_elements, number_ranks_used)),
+      size_block_bytes(sizeof(T) * number_elements_block),
+      size_buffer_bytes(sizeof(T) * number_elements),
+      work_buffer(),
+      source_buffers_reduce_scatter(), target_buffers_reduce_scatter(),
+      source_buffers_allgather(), target_buffers_allgather(),
+      source_buffer_non_power_two_case(), target_buffer_non_power_two_case(),
+      handles(),
+      data_for_1rank_case(),
+      iteration(0),
+      number_iterations(static_cast<std::size_t>(std::log2(number_ranks_used))),
+      alg_stage(AlgStage::NOT_STARTED)
+    {
+      if (number_elements > 0 && number_ranks > 1)
+      {
+        if (is_active_rank())
+        {
+          // All blocks are stored contiguously in the work buffer, such that
+          // the allgather phase can receive directly into it
+          auto const size_work_buffer_bytes = number_ranks_used * size_block_bytes;
+          auto& segment = gaspi::getRuntime().getFreeSegment(size_work_buffer_bytes);
+          work_buffer = std::make_unique<SourceBuffer>(segment, size_work_buffer_bytes);
+          std::memset(work_buffer->address(), 0, size_work_buffer_bytes);
+          auto const work_begin = static_cast<char*>(work_buffer->address());
+
+          for (auto iteration = 0UL; iteration < number_iterations; ++iteration)
+          {
+            auto const distance = get_reduce_scatter_distance(iteration);
+            source_buffers_reduce_scatter.push_back(
+              std::make_unique<SourceBuffer>(*work_buffer));
+            target_buffers_reduce_scatter.push_back(
+              std::make_unique<TargetBuffer>(distance * size_block_bytes));
+
+            auto const neighbor = get_neighbor(distance);
+            auto const source_tag = SourceBuffer::Tag(iteration);
+            auto const target_tag = TargetBuffer::Tag(iteration);
+            handles.push_back(
+              source_buffers_reduce_scatter[iteration]->connectToRemoteTarget(group, neighbor, source_tag));
+            handles.push_back(
+              target_buffers_reduce_scatter[iteration]->connectToRemoteSource(group, neighbor, target_tag));
+          }
+
+          for (auto iteration = 0UL; iteration < number_iterations; ++iteration)
+          {
+            auto const distance = get_allgather_distance(iteration);
+            auto const neighbor_window_begin = work_begin + size_block_bytes *
+              get_allgather_window_block(relabeled_rank ^ distance, iteration);
+            source_buffers_allgather.push_back(
+              std::make_unique<SourceBuffer>(*work_buffer));
+            target_buffers_allgather.push_back(
+              std::make_unique<TargetBuffer>(neighbor_window_begin, segment,
+                                             distance * size_block_bytes));
+
+            auto const neighbor = get_neighbor(distance);
+            auto const source_tag = SourceBuffer::Tag(number_iterations + iteration);
+            auto const target_tag = TargetBuffer::Tag(number_iterations + iteration);
+            handles.push_back(
+              source_buffers_allgather[iteration]->connectToRemoteTarget(group, neighbor, source_tag));
+            handles.push_back(
+              target_buffers_allgather[iteration]->connectToRemoteSource(group, neighbor, target_tag));
+          }
+        }
+
+        if (is_non_extra_rank())
+        {
+          if (is_even_non_extra_rank())
+          {
+            source_buffer_non_power_two_case = std::make_unique<SourceBuffer>(*work_buffer);
+            target_buffer_non_power_two_case = std::make_unique<TargetBuffer>(size_buffer_bytes);
+          }
+          else
+          {
+            // Non-active ranks receive the result into their input buffer,
+            // which is safe as their partner sends it only after having
+            // received the input
+            auto& segment = gaspi::getRuntime().getFreeSegment(size_buffer_bytes);
+            source_buffer_non_power_two_case = std::make_unique<SourceBuffer>(segment, size_buffer_bytes);
+            target_buffer_non_power_two_case = std::make_unique<TargetBuffer>(
+              source_buffer_non_power_two_case->address(), segment, size_buffer_bytes);
+          }
+
+          auto const neighbor = group::Rank(rank.get() ^ 1); // next rank when even, previous otherwise
+          auto const source_tag = SourceBuffer::Tag(2 * number_iterations);
+          auto const target_tag = TargetBuffer::Tag(2 * number_iterations);
+          handles.push_back(
+            source_buffer_non_power_two_case->connectToRemoteTarget(group, neighbor, source_tag));
+          handles.push_back(
+            target_buffer_non_power_two_case->connectToRemoteSource(group, neighbor, target_tag));
+        }
+      }
+      else if (number_elements > 0 && number_ranks == 1)
+      {
+        data_for_1rank_case.resize(number_elements);
+      }
+    }
+
+    template<typename T>
+    void AllreduceLowLevel<T, AllreduceAlgorithm::RABENSEIFNER>::waitForSetupImpl()
+    {
+      for (auto& handle : handles)
+      {
+        handle.waitForCompletion();
+      }
+    }
+
+    template<typename T>
+    void AllreduceLowLevel<T, AllreduceAlgorithm::RABENSEIFNER>::startImpl()
+    {
+      if (number_elements == 0 || number_ranks == 1) { return; }
+
+      iteration = 0;
+      if (is_odd_non_extra_rank())
+      {
+        source_buffer_non_power_two_case->initTransfer();
+        alg_stage = AlgStage::FINAL_STEP_NON_POWER_TWO;
+      }
+      else if (is_even_non_extra_rank())
+      {
+        alg_stage = AlgStage::INITIAL_STEP_NON_POWER_TWO;
+      }
+      else
+      {
+        start_reduce_scatter_iteration();
+        alg_stage = AlgStage::REDUCE_SCATTER;
+      }
+    }
+
+    template<typename T>
+    bool AllreduceLowLevel<T, AllreduceAlgorithm::RABENSEIFNER>::triggerProgressImpl()
+    {
+      if (number_elements == 0 || number_ranks == 1) { return true; }
+
+      switch (alg_stage)
+      {
+        case AlgStage::INITIAL_STEP_NON_POWER_TWO:
+        {
+          // Wait for initial vector from non-active ranks
+          if (!target_buffer_non_power_two_case->checkForCompletion()) { return false; }
+
+          apply_reduce_op<T>(static_cast<T*>(work_buffer->address()),
+                             static_cast<T const*>(target_buffer_non_power_two_case->address()),
+                             number_elements);
+          start_reduce_scatter_iteration();
+          alg_stage = AlgStage::REDUCE_SCATTER;
+          return false;
+        }
+        case AlgStage::REDUCE_SCATTER:
+        {
+          auto& target_buffer = target_buffers_reduce_scatter[iteration];
+          if (!target_buffer->checkForCompletion()) { return false; }
+
+          // The half of the window that has been sent is disjoint from
+          // the one that is kept, such that it can be reduced in place
+          auto const keep_begin = static_cast<T*>(work_buffer->address()) +
+                                  get_reduce_scatter_keep_block(iteration) * number_elements_block;
+          apply_reduce_op<T>(keep_begin,
+                             static_cast<T const*>(target_buffer->address()),
+                             get_reduce_scatter_distance(iteration) * number_elements_block);
+
+          if (!is_last_iteration())
+          {
+            iteration++;
+            start_reduce_scatter_iteration();
+          }
+          else
+          {
+            iteration = 0;
+            start_allgather_iteration();
+            alg_stage = AlgStage::ALLGATHER;
+          }
+          return false;
+        }
+        case AlgStage::ALLGATHER:
+        {
+          if (!target_buffers_allgather[iteration]->checkForCompletion()) { return false; }
+
+          // Allows the neighbor to reuse its work buffer once it has
+          // received all acknowledgements
+          target_buffers_allgather[iteration]->ackTransfer();
+          if (!is_last_iteration())
+          {
+            iteration++;
+            start_allgather_iteration();
+          }
+          else
+          {
+            iteration = 0;
+            alg_stage = AlgStage::WAIT_FOR_ACK;
+          }
+          return false;
+        }
+        case AlgStage::WAIT_FOR_ACK:
+        {
+          // Make sure data has left the work buffer before it can be
+          // overwritten by the next call to `start`
+          while (iteration < number_iterations)
+          {
+            if (!source_buffers_allgather[iteration]->checkForTransferAck()) { return false; }
+            iteration++;
+          }
+
+          // Send results back to non-active ranks
+          if (is_even_non_extra_rank())
+          {
+            source_buffer_non_power_two_case->initTransferPart(size_buffer_bytes);
+          }
+          alg_stage = AlgStage::FINAL_STEP_NON_POWER_TWO;
+          return false;
+        }
+        case AlgStage::FINAL_STEP_NON_POWER_TWO:
+        {
+          bool done = true;
+          if (is_even_non_extra_rank())
+          {
+            done = source_buffer_non_power_two_case->checkForTransferAck();
+          }
+          else if (is_odd_non_extra_rank())
+          {
+            done = target_buffer_non_power_two_case->checkForCompletion();
+            if (done)
+            {
+              target_buffer_non_power_two_case->ackTransfer();
+            }
+          }
+          return done;
+        }
+        case AlgStage::NOT_STARTED:
+        {
+          break;
+        }
+      }
+      return false;
+    }
+
+    template<typename T>
+    void AllreduceLowLevel<T, AllreduceAlgorithm::RABENSEIFNER>::copyInImpl(void const* inputs)
+    {
+      if (number_elements == 0 || inputs == getInPlaceBuffer()) { return; }
+      std::memcpy(getInPlaceBuffer(), inputs, size_buffer_bytes);
+    }
+
+    template<typename T>
+    void AllreduceLowLevel<T, AllreduceAlgorithm::RABENSEIFNER>::copyOutImpl(void* outputs)
+    {
+      if (number_elements == 0 || outputs == getInPlaceBuffer()) { return; }
+      std::memcpy(outputs, getInPlaceBuffer(), size_buffer_bytes);
+    }
+
+    template<typename T>
+    void* AllreduceLowLevel<T, AllreduceAlgorithm::RABENSEIFNER>::getInPlaceBuffer()
+    {
+      if (number_elements > 0 && number_ranks > 1)
+      {
+        if (is_active_rank())
+        {
+          return work_buffer->address();
+        }
+        return source_buffer_non_power_two_case->address();
+      }
+      return data_for_1rank_case.data();
+    }
+
+    template<typename T>
+    bool AllreduceLowLevel<T, AllreduceAlgorithm::RABENSEIFNER>::is_extra_rank() const
+    {
+      return rank.get() >= 2 * number_ranks_rest;
+    }
+
+    template<typename T>
+    bool AllreduceLowLevel<T, AllreduceAlgorithm::RABENSEIFNER>::is_non_extra_rank() const
+    {
+      return !is_extra_rank();
+    }
+
+    template<typename T>
+    bool AllreduceLowLevel<T, AllreduceAlgorithm::RABENSEIFNER>::is_even_non_extra_rank() const
+    {
+      return (rank.get() % 2 == 0) && is_non_extra_rank();
+    }
+
+    template<typename T>
+    bool AllreduceLowLevel<T, AllreduceAlgorithm::RABENSEIFNER>::is_odd_non_extra_rank() const
+    {
+      return (rank.get() % 2 == 1) && is_non_extra_rank();
+    }
+
+    template<typename T>
+    bool AllreduceLowLevel<T, AllreduceAlgorithm::RABENSEIFNER>::is_active_rank() const
+    {
+      return is_even_non_extra_rank() || is_extra_rank();
+    }
+
+    template<typename T>
+    bool AllreduceLowLevel<T, AllreduceAlgorithm::RABENSEIFNER>::is_last_iteration() const
+    {
+      return iteration == number_iterations - 1;
+    }
+
+    template<typename T>
+    gaspi::group::Rank AllreduceLowLevel<T, AllreduceAlgorithm::RABENSEIFNER>::get_neighbor(
+                          std::size_t distance) const
+    {
+      auto const relabeled_neighbor = relabeled_rank ^ distance; // +/- distance
+      return relabeled_neighbor < number_ranks_rest ?
+               group::Rank(relabeled_neighbor * 2) :
+               group::Rank(relabeled_neighbor + number_ranks_rest);
+    }
+
+    template<typename T>
+    std::size_t AllreduceLowLevel<T, AllreduceAlgorithm::RABENSEIFNER>::get_reduce_scatter_distance(
+                          std::size_t iteration) const
+    {
+      return number_ranks_used >> (iteration + 1);
+    }
+
+    // First block of the half of the current window that is sent to the neighbor
+    template<typename T>
+    std::size_t AllreduceLowLevel<T, AllreduceAlgorithm::RABENSEIFNER>::get_reduce_scatter_send_block(
+                          std::size_t iteration) const
+    {
+      auto const distance = get_reduce_scatter_distance(iteration);
+      return (relabeled_rank ^ distance) & ~(distance - 1);
+    }
+
+    // First block of the half of the current window that is kept and reduced
+    template<typename T>
+    std::size_t AllreduceLowLevel<T, AllreduceAlgorithm::RABENSEIFNER>::get_reduce_scatter_keep_block(
+                          std::size_t iteration) const
+    {
+      auto const distance = get_reduce_scatter_distance(iteration);
+      return relabeled_rank & ~(distance - 1);
+    }
+
+    template<typename T>
+    std::size_t AllreduceLowLevel<T, AllreduceAlgorithm::RABENSEIFNER>::get_allgather_distance(
+                          std::size_t iteration) const
+    {
+      return 1UL << iteration;
+    }
+
+    // First block of the window owned by (relabelled) rank `window_owner`
+    // before the given iteration
+    template<typename T>
+    std::size_t AllreduceLowLevel<T, AllreduceAlgorithm::RABENSEIFNER>::get_allgather_window_block(
+                          std::size_t window_owner,
+                          std::size_t iteration) const
+    {
+      auto const distance = get_allgather_distance(iteration);
+      return window_owner & ~(distance - 1);
+    }
+
+    template<typename T>
+    void AllreduceLowLevel<T, AllreduceAlgorithm::RABENSEIFNER>::start_reduce_scatter_iteration()
+    {
+      auto const distance = get_reduce_scatter_distance(iteration);
+      source_buffers_reduce_scatter[iteration]->initTransferPart(
+        distance * size_block_bytes,
+        get_reduce_scatter_send_block(iteration) * size_block_bytes);
+    }
+
+    template<typename T>
+    void AllreduceLowLevel<T, AllreduceAlgorithm::RABENSEIFNER>::start_allgather_iteration()
+    {
+      auto const distance = get_allgather_distance(iteration);
+      source_buffers_allgather[iteration]->initTransferPart(
+        distance * size_block_bytes,
+        get_allgather_window_block(relabeled_rank, iteration) * size_block_bytes);
+    }
+  }
+}
@@ -21,12 +21,14 @@
 
 #pragma once
 
+#include <GaspiCxx/Runtime.hpp>
 #include <GaspiCxx/group/Utilities.hpp>
 #include <GaspiCxx/singlesided/write/SourceBuffer.hpp>
 #include <GaspiCxx/singlesided/write/TargetBuffer.hpp>
 #include <GaspiCxx/singlesided/BufferDescription.hpp>
 #include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/CollectiveLowLevel.hpp>
 #include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/Utilities.hpp>
 
 #include <algorithm>
 #include <cmath>
@@ -37,18 +39,6 @@ namespace gaspi
 {
   namespace collectives
   {
-    namespace
-    {
-      template <typename Integer,
-                std::enable_if_t<std::is_integral<Integer>::value, bool> = true>
-      Integer nearest_power_of_two_less_equal(Integer i)
-      {
-        auto const exponent = std::trunc(std::log2(i));
-        auto const power = std::pow(2, exponent);
-        return static_cast<Integer>(power);
-      }
-    }
-
     /*
      * RECURSIVE (DISTANCE) DOUBLING
      * =============================
@@ -145,7 +135,9 @@ namespace gaspi
 
         AllreduceLowLevel(gaspi::group::Group const& group,
                           std::size_t number_elements,
-                          ReductionOp reduction_op);
+                          ReductionKernel<T> reduction_kernel);
+
+        void* getInPlaceBuffer() override;
 
       private:
         enum class AlgStage
@@ -164,6 +156,9 @@ namespace gaspi
 
         std::vector<std::unique_ptr<SourceBuffer>> source_buffers;
         std::vector<std::unique_ptr<TargetBuffer>> target_buffers;
+        // first-iteration buffers used instead on every other run
+        std::unique_ptr<SourceBuffer> source_buffer_alternate_run;
+        std::unique_ptr<TargetBuffer> target_buffer_alternate_run;
         std::unique_ptr<SourceBuffer> source_buffer_non_power_two_case;
         std::unique_ptr<TargetBuffer> target_buffer_non_power_two_case;
         std::size_t size_buffer_bytes;
@@ -175,6 +170,7 @@ namespace gaspi
         std::size_t number_iterations;
 
         AlgStage alg_stage;
+        bool is_alternate_run;
 
         void waitForSetupImpl() override;
         void copyInImpl(void const*) override;
@@ -192,26 +188,32 @@ namespace gaspi
         bool is_power_two_case() const;
         bool is_non_power_two_case() const;
         bool is_last_iteration() const;
+        gaspi::group::Rank get_neighbor(std::size_t iteration) const;
+        SourceBuffer& get_source_buffer(std::size_t iteration);
+        TargetBuffer& get_target_buffer(std::size_t iteration);
     };
 
     template<typename T>
     AllreduceLowLevel<T, AllreduceAlgorithm::RECURSIVE_DOUBLING>::AllreduceLowLevel(
                       gaspi::group::Group const& group,
                       std::size_t number_elements,
-                      ReductionOp reduction_op)
-    : AllreduceCommon(group, number_elements, reduction_op),
+                      ReductionKernel<T> reduction_kernel)
+    : AllreduceCommon(group, number_elements,
+                      reduction_kernel.get_untyped_kernel()),
       number_ranks(group.size()),
       number_ranks_used(nearest_power_of_two_less_equal(number_ranks)),
       number_ranks_rest(number_ranks - number_ranks_used),
       rank(group.rank()),
       source_buffers(), target_buffers(),
+      source_buffer_alternate_run(), target_buffer_alternate_run(),
       source_buffer_non_power_two_case(), target_buffer_non_power_two_case(),
       size_buffer_bytes(sizeof(T) * number_elements),
       handles(),
       data_for_1rank_case(),
       iteration(0),
       number_iterations(static_cast<std::size_t>(std::log2(number_ranks_used))),
-      alg_stage(AlgStage::NOT_STARTED)
+      alg_stage(AlgStage::NOT_STARTED),
+      is_alternate_run(true)
     {
       if (number_elements > 0 && number_ranks > 1)
       {
@@ -228,13 +230,7 @@ namespace gaspi
 
           for (auto iteration = 0UL; iteration < number_iterations; ++iteration)
           {
-            auto const distance = static_cast<std::size_t>(std::exp2(iteration));
-            auto const relabeled_rank = rank.get() < 2 * number_ranks_rest ?
-                                          rank.get() / 2 : rank.get() - number_ranks_rest;
-            auto const relabeled_neighbor = relabeled_rank ^ distance; // +/- distance
-            auto const neighbor = relabeled_neighbor < number_ranks_rest ?
-                                    group::Rank(relabeled_neighbor * 2) :
-                                    group::Rank(relabeled_neighbor + number_ranks_rest);
+            auto const neighbor = get_neighbor(iteration);
             auto const source_tag = SourceBuffer::Tag(iteration);
             auto const target_tag = TargetBuffer::Tag(iteration);
             handles.push_back(
@@ -242,6 +238,23 @@ namespace gaspi
             handles.push_back(
               target_buffers[iteration]->connectToRemoteSource(group, neighbor, target_tag));
           }
+
+          // Data received in the last iteration is acknowledged before it is
+          // reduced, such that the partner may already start the next run.
+          // Alternating the target buffer of the first iteration between runs
+          // avoids overwriting it when the first iteration is also the last.
+          if (number_iterations > 0)
+          {
+            auto const first_neighbor = get_neighbor(0);
+            source_buffer_alternate_run = std::make_unique<SourceBuffer>(*source_buffers.front());
+            target_buffer_alternate_run = std::make_unique<TargetBuffer>(size_buffer_bytes);
+            auto const source_tag = SourceBuffer::Tag(number_iterations + 1);
+            auto const target_tag = TargetBuffer::Tag(number_iterations + 1);
+            handles.push_back(
+              source_buffer_alternate_run->connectToRemoteTarget(group, first_neighbor, source_tag));
+            handles.push_back(
+              target_buffer_alternate_run->connectToRemoteSource(group, first_neighbor, target_tag));
+          }
         }
 
         if (is_non_extra_rank())
@@ -249,12 +262,18 @@ namespace gaspi
           if (is_even_non_extra_rank())
           {
             source_buffer_non_power_two_case = std::make_unique<SourceBuffer>(*source_buffers.back());
+            target_buffer_non_power_two_case = std::make_unique<TargetBuffer>(size_buffer_bytes);
           }
           else
           {
-            source_buffer_non_power_two_case = std::make_unique<SourceBuffer>(size_buffer_bytes);
+            // Non-active ranks receive the result into their input buffer,
+            // which is safe as their partner sends it only after having
+            // received the input
+            auto& segment = gaspi::getRuntime().getFreeSegment(size_buffer_bytes);
+            source_buffer_non_power_two_case = std::make_unique<SourceBuffer>(segment, size_buffer_bytes);
+            target_buffer_non_power_two_case = std::make_unique<TargetBuffer>(
+              source_buffer_non_power_two_case->address(), segment, size_buffer_bytes);
           }
-          target_buffer_non_power_two_case = std::make_unique<TargetBuffer>(size_buffer_bytes);
 
           auto const neighbor = group::Rank(rank.get() ^ 1); // next rank when even, previous otherwise
           auto const source_tag = SourceBuffer::Tag(number_iterations);
@@ -286,11 +305,12 @@ namespace gaspi
       if (number_elements == 0 || number_ranks == 1) { return; }
 
       iteration = 0;
+      is_alternate_run = !is_alternate_run;
       alg_stage = is_non_extra_rank() ? AlgStage::INITIAL_STEP_NON_POWER_TWO:
                                         AlgStage::WAIT_FOR_DATA;
       if (is_extra_rank())
       {
-        source_buffers[iteration]->initTransfer();
+        get_source_buffer(iteration).initTransfer();
       }
       if (is_odd_non_extra_rank())
       {
@@ -311,8 +331,8 @@ namespace gaspi
         made_progress = target_buffer_non_power_two_case->checkForCompletion();
         if (!made_progress) { return false; }
 
-        apply_reduce_op<T>(*source_buffers[iteration], *target_buffer_non_power_two_case);
-        source_buffers[iteration]->initTransfer();
+        apply_reduce_op<T>(get_source_buffer(iteration), *target_buffer_non_power_two_case);
+        get_source_buffer(iteration).initTransfer();
         alg_stage = AlgStage::WAIT_FOR_DATA;
       }
 
@@ -342,11 +362,11 @@ namespace gaspi
         bool made_progress = false;
         if (alg_stage == AlgStage::WAIT_FOR_DATA)
         {
-          made_progress = target_buffers[iteration]->checkForCompletion();
+          made_progress = get_target_buffer(iteration).checkForCompletion();
         }
         else if (alg_stage == AlgStage::WAIT_FOR_ACK)
         {
-          made_progress = source_buffers[iteration]->checkForTransferAck();
+          made_progress = get_source_buffer(iteration).checkForTransferAck();
         }
         if (!made_progress) { return false; }
 
@@ -355,13 +375,13 @@ namespace gaspi
           // Make sure data has left source_buffers[iteration] before
           // accumulating the data received in target_buffers[iteration],
           // which can only be done with notifications.
-          target_buffers[iteration]->ackTransfer();
+          get_target_buffer(iteration).ackTransfer();
           alg_stage = AlgStage::WAIT_FOR_ACK;
           return false;
         }
         else
         {
-          apply_reduce_op<T>(*source_buffers[iteration], *target_buffers[iteration]);
+          apply_reduce_op<T>(get_source_buffer(iteration), get_target_buffer(iteration));
           if (!is_last_iteration())
           {
             source_buffers[iteration + 1]->initTransfer();
@@ -386,41 +406,29 @@ namespace gaspi
     template<typename T>
     void AllreduceLowLevel<T, AllreduceAlgorithm::RECURSIVE_DOUBLING>::copyInImpl(void const* inputs)
     {
-      if (number_elements > 0 && number_ranks > 1)
-      {
-        if (is_active_rank())
-        {
-          std::memcpy(source_buffers.front()->address(), inputs, size_buffer_bytes);
-        }
-        else
-        {
-          std::memcpy(source_buffer_non_power_two_case->address(), inputs, size_buffer_bytes);
-        }
-      }
-      else if (number_elements > 0 && number_ranks == 1)
-      {
-        std::memcpy(data_for_1rank_case.data(), inputs, size_buffer_bytes);
-      }
+      if (number_elements == 0 || inputs == getInPlaceBuffer()) { return; }
+      std::memcpy(getInPlaceBuffer(), inputs, size_buffer_bytes);
     }
 
     template<typename T>
     void AllreduceLowLevel<T, AllreduceAlgorithm::RECURSIVE_DOUBLING>::copyOutImpl(void* outputs)
+    {
+      if (number_elements == 0 || outputs == getInPlaceBuffer()) { return; }
+      std::memcpy(outputs, getInPlaceBuffer(), size_buffer_bytes);
+    }
+
+    template<typename T>
+    void* AllreduceLowLevel<T, AllreduceAlgorithm::RECURSIVE_DOUBLING>::getInPlaceBuffer()
     {
       if (number_elements > 0 && number_ranks > 1)
       {
         if (is_active_rank())
         {
-          std::memcpy(outputs, source_buffers.back()->address(), size_buffer_bytes);
-        }
-        else
-        {
-          std::memcpy(outputs, target_buffer_non_power_two_case->address(), size_buffer_bytes);
+          return source_buffers.front()->address();
         }
+        return source_buffer_non_power_two_case->address();
       }
-      else if (number_elements > 0 && number_ranks == 1)
-      {
-        std::memcpy(outputs, data_for_1rank_case.data(), size_buffer_bytes);
-      }
+      return data_for_1rank_case.data();
     }
 
     template<typename T>
@@ -470,5 +478,42 @@ namespace gaspi
     {
       return iteration == number_iterations - 1;
     }
+  
+    template<typename T>
+    gaspi::group::Rank AllreduceLowLevel<T, AllreduceAlgorithm::RECURSIVE_DOUBLING>::get_neighbor(
+      std::size_t iteration) const
+    {
+      auto const distance = static_cast<std::size_t>(std::exp2(iteration));
+      auto const relabeled_rank = rank.get() < 2 * number_ranks_rest ?
+                                    rank.get() / 2 : rank.get() - number_ranks_rest;
+      auto const relabeled_neighbor = relabeled_rank ^ distance; // +/- distance
+      return relabeled_neighbor < number_ranks_rest ?
+               group::Rank(relabeled_neighbor * 2) :
+               group::Rank(relabeled_neighbor + number_ranks_rest);
+    }
+
+    template<typename T>
+    typename AllreduceLowLevel<T, AllreduceAlgorithm::RECURSIVE_DOUBLING>::SourceBuffer&
+    AllreduceLowLevel<T, AllreduceAlgorithm::RECURSIVE_DOUBLING>::get_source_buffer(
+      std::size_t iteration)
+    {
+      if (iteration == 0 && is_alternate_run)
+      {
+        return *source_buffer_alternate_run;
+      }
+      return *source_buffers[iteration];
+    }
+
+    template<typename T>
+    typename AllreduceLowLevel<T, AllreduceAlgorithm::RECURSIVE_DOUBLING>::TargetBuffer&
+    AllreduceLowLevel<T, AllreduceAlgorithm::RECURSIVE_DOUBLING>::get_target_buffer(
+      std::size_t iteration)
+    {
+      if (iteration == 0 && is_alternate_run)
+      {
+        return *target_buffer_alternate_run;
+      }
+      return *target_buffers[iteration];
+    }
   }
 }
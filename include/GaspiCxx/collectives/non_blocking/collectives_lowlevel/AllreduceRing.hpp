@@ -21,12 +21,14 @@
 
 #pragma once
 
+#include <GaspiCxx/Runtime.hpp>
 #include <GaspiCxx/group/Utilities.hpp>
 #include <GaspiCxx/singlesided/write/SourceBuffer.hpp>
 #include <GaspiCxx/singlesided/write/TargetBuffer.hpp>
 #include <GaspiCxx/singlesided/BufferDescription.hpp>
 #include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/CollectiveLowLevel.hpp>
 #include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/Utilities.hpp>
 
 #include <algorithm>
 #include <memory>
@@ -36,15 +38,19 @@ namespace gaspi
 {
   namespace collectives
   {
-    namespace
+    // Runtime settings of the RING algorithm
+    struct AllreduceRingSettings
     {
-      template <typename Integer,
-                std::enable_if_t<std::is_integral<Integer>::value, bool> = true>
-      Integer ceil_div(Integer a, Integer b)
-      {
-        return (a + b - 1) / b;
-      }
-    }
+      // Maximum size of the chunks each ring block is split into, such that
+      // the reduction of a chunk overlaps with the transfer of the next one
+      // (0 disables the splitting)
+      static inline std::size_t chunk_size_bytes = 1024 * 1024;
+
+      // Use two sets of buffers in alternating runs, such that a run can
+      // complete without waiting for its final transfers to be acknowledged
+      // (at the cost of twice the memory)
+      static inline bool double_buffering = false;
+    };
 
     template<typename T>
     class AllreduceLowLevel<T, AllreduceAlgorithm::RING> : public AllreduceCommon
@@ -58,7 +64,13 @@ namespace gaspi
 
         AllreduceLowLevel(gaspi::group::Group const& group,
                           std::size_t number_elements,
-                          ReductionOp reduction_op);
+                          ReductionKernel<T> reduction_kernel,
+                          std::size_t chunk_size_bytes = AllreduceRingSettings::chunk_size_bytes,
+                          bool double_buffering = AllreduceRingSettings::double_buffering);
+
+        // With double buffering, the in-place buffer alternates between
+        // runs, i.e., it changes after the results have been copied out
+        void* getInPlaceBuffer() override;
 
       private:
         enum class RingStage
@@ -71,14 +83,29 @@ namespace gaspi
         gaspi::group::Rank rank;
         gaspi::group::Rank left_neighbor;
         gaspi::group::Rank right_neighbor;
-        std::vector<std::unique_ptr<SourceBuffer>> source_buffers_reduce;
-        std::vector<std::unique_ptr<TargetBuffer>> target_buffers_reduce;
-        std::vector<std::unique_ptr<SourceBuffer>> source_buffers_gather;
-        std::vector<std::unique_ptr<TargetBuffer>> target_buffers_gather;
+        std::size_t number_elements_block;
+        std::size_t number_elements_chunk;
+        std::size_t number_chunks;
+
+        // communication buffers used by a run
+        struct BufferSet
+        {
+          // all blocks, stored contiguously
+          std::unique_ptr<SourceBuffer> data_buffer;
+          // one buffer per chunk, indexed by `get_chunk_index(block, chunk)`
+          std::vector<std::unique_ptr<SourceBuffer>> source_buffers_reduce;
+          std::vector<std::unique_ptr<TargetBuffer>> target_buffers_reduce;
+          std::vector<std::unique_ptr<SourceBuffer>> source_buffers_gather;
+          std::vector<std::unique_ptr<TargetBuffer>> target_buffers_gather;
+        };
+        // one set, or two sets for double buffering
+        std::vector<BufferSet> buffer_sets;
+        std::size_t current_set;
         std::vector<ConnectHandle> handles;
         std::vector<T> data_for_1rank_case;
       
         std::size_t current_step;
+        std::size_t current_chunk;
         std::size_t steps_per_stage;
         gaspi::group::RingIndex current_index;
 
@@ -94,59 +121,91 @@ namespace gaspi
         bool is_last_step_reduce() const;
         bool is_last_step_gather() const;
         bool is_last_step() const;
+
+        bool is_double_buffered() const;
+
+        T* get_chunk_begin(BufferSet const& buffers,
+                           std::size_t block, std::size_t chunk) const;
+        std::size_t get_chunk_index(std::size_t block, std::size_t chunk) const;
+        std::size_t get_chunk_number_elements(std::size_t chunk) const;
+        void start_chunk_transfer(SourceBuffer& buffer, std::size_t block, std::size_t chunk);
     };
 
     template<typename T>
     AllreduceLowLevel<T, AllreduceAlgorithm::RING>::AllreduceLowLevel(
                       gaspi::group::Group const& group,
                       std::size_t number_elements,
-                      ReductionOp reduction_op)
-    : AllreduceCommon(group, number_elements, reduction_op),
+                      ReductionKernel<T> reduction_kernel,
+                      std::size_t chunk_size_bytes,
+                      bool double_buffering)
+    : AllreduceCommon(group, number_elements,
+                      reduction_kernel.get_untyped_kernel()),
       number_ranks(group.size()),
       rank(group.rank()),
       left_neighbor(group::decrementRankOnRing(rank, number_ranks)),
       right_neighbor(group::incrementRankOnRing(rank, number_ranks)),
-      source_buffers_reduce(), target_buffers_reduce(), source_buffers_gather(), target_buffers_gather(),
+      number_elements_block(ceil_div(number_elements, number_ranks)),
+      number_elements_chunk(chunk_size_bytes == 0 ? number_elements_block :
+                            std::min(std::max(chunk_size_bytes / sizeof(T), 1UL),
+                                     number_elements_block)),
+      number_chunks(number_elements_chunk == 0 ? 0 :
+                    ceil_div(number_elements_block, number_elements_chunk)),
+      buffer_sets(),
+      current_set(0),
       handles(),
       data_for_1rank_case(),
       current_step(0),
+      current_chunk(0),
       steps_per_stage(number_ranks-1),
       current_index(rank.get(), number_ranks)
     {
       if (number_elements > 0 && number_ranks > 1)
       {
-        auto const number_elements_padded = ceil_div(number_elements, number_ranks);
-        auto const size_padded = sizeof(T) * number_elements_padded;
-
-        for (auto i = 0UL; i < number_ranks; ++i)
+        // Double buffering is safe without final acknowledgements, since a
+        // rank completes a run only after all ranks have started it, i.e.,
+        // after its right neighbor has received all data of the previous run.
+        buffer_sets.resize(double_buffering ? 2 : 1);
+
+        auto const size_padded = sizeof(T) * number_elements_block * number_ranks;
+        auto const number_buffers = number_ranks * number_chunks;
+        for (auto set = 0UL; set < buffer_sets.size(); ++set)
         {
-          source_buffers_reduce.push_back(
-            std::make_unique<SourceBuffer>(size_padded));
-          target_buffers_reduce.push_back(
-            std::make_unique<TargetBuffer>(size_padded));
-        }
+          auto& buffers = buffer_sets[set];
+          auto& segment = gaspi::getRuntime().getFreeSegment(size_padded);
+          buffers.data_buffer = std::make_unique<SourceBuffer>(segment, size_padded);
 
-        // Make sends in gather phase in-place
-        for (auto i = 0UL; i < number_ranks; ++i)
-        {
-          source_buffers_gather.push_back(std::make_unique<SourceBuffer>(*source_buffers_reduce[i]));
-          target_buffers_gather.push_back(std::make_unique<TargetBuffer>(*source_buffers_reduce[i]));
-        }
+          for (auto block = 0UL; block < number_ranks; ++block)
+          {
+            for (auto chunk = 0UL; chunk < number_chunks; ++chunk)
+            {
+              auto const size_chunk = sizeof(T) * get_chunk_number_elements(chunk);
+              buffers.source_buffers_reduce.push_back(
+                std::make_unique<SourceBuffer>(*buffers.data_buffer));
+              buffers.target_buffers_reduce.push_back(std::make_unique<TargetBuffer>(size_chunk));
+
+              // Make sends in gather phase in-place
+              buffers.source_buffers_gather.push_back(
+                std::make_unique<SourceBuffer>(*buffers.data_buffer));
+              buffers.target_buffers_gather.push_back(std::make_unique<TargetBuffer>(
+                get_chunk_begin(buffers, block, chunk), segment, size_chunk));
+            }
+          }
 
-        for (auto i = 0UL; i < number_ranks; ++i)
-        {
-          SourceBuffer::Tag const source_tag_reduce = i;
-          TargetBuffer::Tag const target_tag_reduce = i;
-          SourceBuffer::Tag const source_tag_gather = i + number_ranks;
-          TargetBuffer::Tag const target_tag_gather = i + number_ranks;
-          handles.push_back(
-            source_buffers_reduce[i]->connectToRemoteTarget(group, right_neighbor, source_tag_reduce));
-          handles.push_back(
-            target_buffers_reduce[i]->connectToRemoteSource(group, left_neighbor, target_tag_reduce));
-          handles.push_back(
-            source_buffers_gather[i]->connectToRemoteTarget(group, right_neighbor, source_tag_gather));
-          handles.push_back(
-            target_buffers_gather[i]->connectToRemoteSource(group, left_neighbor, target_tag_gather));
+          for (auto i = 0UL; i < number_buffers; ++i)
+          {
+            SourceBuffer::Tag const source_tag_reduce = i + 2 * set * number_buffers;
+            TargetBuffer::Tag const target_tag_reduce = i + 2 * set * number_buffers;
+            SourceBuffer::Tag const source_tag_gather = i + (2 * set + 1) * number_buffers;
+            TargetBuffer::Tag const target_tag_gather = i + (2 * set + 1) * number_buffers;
+            handles.push_back(buffers.source_buffers_reduce[i]->connectToRemoteTarget(
+              group, right_neighbor, source_tag_reduce));
+            handles.push_back(buffers.target_buffers_reduce[i]->connectToRemoteSource(
+              group, left_neighbor, target_tag_reduce));
+            handles.push_back(buffers.source_buffers_gather[i]->connectToRemoteTarget(
+              group, right_neighbor, source_tag_gather));
+            handles.push_back(buffers.target_buffers_gather[i]->connectToRemoteSource(
+              group, left_neighbor, target_tag_gather));
+          }
         }
       }
       else
@@ -170,8 +229,14 @@ namespace gaspi
       if (number_elements > 0 && number_ranks > 1)
       {
         current_step = 0;
+        current_chunk = 0;
         current_index = group::RingIndex(rank.get(), number_ranks);
-        source_buffers_reduce[current_index]->initTransfer();
+        auto& buffers = buffer_sets[current_set];
+        for (auto chunk = 0UL; chunk < number_chunks; ++chunk)
+        {
+          start_chunk_transfer(*buffers.source_buffers_reduce[get_chunk_index(current_index, chunk)],
+                               current_index, chunk);
+        }
         current_index--;
       }
     }
@@ -181,59 +246,83 @@ namespace gaspi
     {
       if (number_elements == 0 || number_ranks == 1) { return true; }
 
-      auto made_progress = false;
+      auto& buffers = buffer_sets[current_set];
       if (is_last_step()) // wait for final transfer acknowledgements
       {
-        auto index = group::RingIndex(current_index + 2, number_ranks);
-        made_progress = source_buffers_gather[index]->checkForTransferAck();
-        return made_progress;
-      }
+        if (is_double_buffered()) { return true; }
 
-      // each algorithm stage starts by waiting for data to arrive
-      switch(algorithm_get_current_stage())
-      {
-        case RingStage::REDUCE:
-        {
-          made_progress = target_buffers_reduce[current_index]->checkForCompletion();
-          break;
-        }
-        case RingStage::GATHER:
+        auto index = group::RingIndex(current_index + 2, number_ranks);
+        while (current_chunk < number_chunks)
         {
-          made_progress = target_buffers_gather[current_index]->checkForCompletion();
+          if (!buffers.source_buffers_gather[get_chunk_index(index, current_chunk)]->checkForTransferAck())
+          {
+            return false;
+          }
+          current_chunk++;
         }
+        return true;
       }
-      if (!made_progress) { return false; }
 
-      // when data transfer for the current stage had ended, start transfers
-      // for the next iteration
-      switch(algorithm_get_current_stage())
+      // Chunks are forwarded as soon as they arrive, such that the reduction
+      // of a chunk overlaps with the transfer of the next ones
+      while (current_chunk < number_chunks)
       {
-        case RingStage::REDUCE:
+        auto const chunk_index = get_chunk_index(current_index, current_chunk);
+
+        // each algorithm stage starts by waiting for data to arrive
+        auto made_progress = false;
+        switch(algorithm_get_current_stage())
         {
-          apply_reduce_op<T>(*source_buffers_reduce[current_index], *target_buffers_reduce[current_index]);
-          if (!is_last_step_reduce())
+          case RingStage::REDUCE:
           {
-            source_buffers_reduce[current_index]->initTransfer();
+            made_progress = buffers.target_buffers_reduce[chunk_index]->checkForCompletion();
+            break;
           }
-          else
+          case RingStage::GATHER:
           {
-            source_buffers_gather[current_index]->initTransfer();
+            made_progress = buffers.target_buffers_gather[chunk_index]->checkForCompletion();
           }
-          break;
         }
-        case RingStage::GATHER:
+        if (!made_progress) { return false; }
+
+        // when data transfer for the current chunk had ended, start transfers
+        // for the next iteration
+        switch(algorithm_get_current_stage())
         {
-          if (!is_last_step_gather())
+          case RingStage::REDUCE:
           {
-            source_buffers_gather[current_index]->initTransfer();
+            apply_reduce_op<T>(get_chunk_begin(buffers, current_index, current_chunk),
+                               static_cast<T const*>(buffers.target_buffers_reduce[chunk_index]->address()),
+                               get_chunk_number_elements(current_chunk));
+            if (!is_last_step_reduce())
+            {
+              start_chunk_transfer(*buffers.source_buffers_reduce[chunk_index],
+                                   current_index, current_chunk);
+            }
+            else
+            {
+              start_chunk_transfer(*buffers.source_buffers_gather[chunk_index],
+                                   current_index, current_chunk);
+            }
+            break;
           }
-          else
+          case RingStage::GATHER:
           {
-            target_buffers_gather[current_index]->ackTransfer();
+            if (!is_last_step_gather())
+            {
+              start_chunk_transfer(*buffers.source_buffers_gather[chunk_index],
+                                   current_index, current_chunk);
+            }
+            else if (!is_double_buffered())
+            {
+              buffers.target_buffers_gather[chunk_index]->ackTransfer();
+            }
           }
         }
+        current_chunk++;
       }
 
+      current_chunk = 0;
       current_step++;
       current_index--;
       return false;
@@ -242,70 +331,35 @@ namespace gaspi
     template<typename T>
     void AllreduceLowLevel<T, AllreduceAlgorithm::RING>::copyInImpl(void const* inputs)
     {
-      auto total_copied_elements = 0UL;
-      auto current_begin = static_cast<T const*>(inputs);
-
-      if (number_ranks == 1)
-      {
-        std::copy(current_begin, current_begin + number_elements,
-                  data_for_1rank_case.begin());
-      }
-      else
-      {
-        for (auto& buffer : source_buffers_reduce)
-        {
-          auto elements_to_copy = buffer->description().size()/sizeof(T);
-          if (total_copied_elements + elements_to_copy > number_elements)
-          {
-            elements_to_copy = number_elements - total_copied_elements;
-          }
-
-          auto const current_end = current_begin + elements_to_copy;
-          std::copy(current_begin, current_end, static_cast<T*>(buffer->address()));
-          current_begin = current_end;
-          total_copied_elements += elements_to_copy;
+      if (inputs == getInPlaceBuffer()) { return; }
 
-          if (total_copied_elements >= number_elements)
-          {
-            break;
-          }
-        }
-      }
+      auto const begin = static_cast<T const*>(inputs);
+      std::copy(begin, begin + number_elements, static_cast<T*>(getInPlaceBuffer()));
     }
 
     template<typename T>
     void AllreduceLowLevel<T, AllreduceAlgorithm::RING>::copyOutImpl(void* outputs)
     {
-      auto total_copied_elements = 0UL;
-      auto current_start = static_cast<T*>(outputs);
-
-      if (number_ranks == 1)
+      if (outputs != getInPlaceBuffer())
       {
-        std::copy(data_for_1rank_case.begin(), data_for_1rank_case.end(),
-                  current_start);
+        auto const begin = static_cast<T const*>(getInPlaceBuffer());
+        std::copy(begin, begin + number_elements, static_cast<T*>(outputs));
       }
-      else
-      {
-        for (auto& buffer : source_buffers_gather)
-        {
-          auto elements_to_copy = buffer->description().size()/sizeof(T);
-          if (total_copied_elements + elements_to_copy > number_elements)
-          {
-            elements_to_copy = number_elements - total_copied_elements;
-          }
 
-          auto const buffer_start = static_cast<T*>(buffer->address());
-          auto const buffer_end = buffer_start + elements_to_copy;
-          std::copy(buffer_start, buffer_end, current_start);
-          current_start = current_start + elements_to_copy;
-          total_copied_elements += elements_to_copy;
+      if (is_double_buffered())
+      {
+        current_set = 1 - current_set;
+      }
+    }
 
-          if (total_copied_elements >= number_elements)
-          {
-            break;
-          }
-        }
+    template<typename T>
+    void* AllreduceLowLevel<T, AllreduceAlgorithm::RING>::getInPlaceBuffer()
+    {
+      if (number_elements > 0 && number_ranks > 1)
+      {
+        return buffer_sets[current_set].data_buffer->address();
       }
+      return data_for_1rank_case.data();
     }
 
     template<typename T>
@@ -331,5 +385,43 @@ namespace gaspi
     {
       return current_step == 2 * steps_per_stage;
     }
+
+    template<typename T>
+    bool AllreduceLowLevel<T, AllreduceAlgorithm::RING>::is_double_buffered() const
+    {
+      return buffer_sets.size() > 1;
+    }
+
+    template<typename T>
+    T* AllreduceLowLevel<T, AllreduceAlgorithm::RING>::get_chunk_begin(
+                  BufferSet const& buffers, std::size_t block, std::size_t chunk) const
+    {
+      return static_cast<T*>(buffers.data_buffer->address())
+             + block * number_elements_block + chunk * number_elements_chunk;
+    }
+
+    template<typename T>
+    std::size_t AllreduceLowLevel<T, AllreduceAlgorithm::RING>::get_chunk_index(
+                  std::size_t block, std::size_t chunk) const
+    {
+      return block * number_chunks + chunk;
+    }
+
+    template<typename T>
+    std::size_t AllreduceLowLevel<T, AllreduceAlgorithm::RING>::get_chunk_number_elements(
+                  std::size_t chunk) const
+    {
+      return std::min(number_elements_chunk,
+                      number_elements_block - chunk * number_elements_chunk);
+    }
+
+    template<typename T>
+    void AllreduceLowLevel<T, AllreduceAlgorithm::RING>::start_chunk_transfer(
+                  SourceBuffer& buffer, std::size_t block, std::size_t chunk)
+    {
+      buffer.initTransferPart(sizeof(T) * get_chunk_number_elements(chunk),
+                              sizeof(T) * (block * number_elements_block +
+                                           chunk * number_elements_chunk));
+    }
   }
 }
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * AlltoallvAuto.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AlgorithmSelection.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllgathervCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AlltoallvBruck.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AlltoallvCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AlltoallvPairwiseExchange.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // Default rules, favoring Bruck's algorithm for latency-bound small
+    // messages and the pairwise exchange otherwise
+    SelectionTable const& get_builtin_alltoallv_selection_table();
+
+    // Selection table of the AUTO algorithm, taken from the "alltoallv" table
+    // of the tuning file (cf. `get_tuning_file`), or the built-in rules
+    SelectionTable get_alltoallv_selection_table();
+
+    AlltoallvAlgorithm select_alltoallv_algorithm(std::size_t number_ranks,
+                                                  std::size_t message_bytes);
+
+    // Dispatches at runtime to the algorithm selected for the group size and
+    // the largest amount of data sent by any rank (determined at construction).
+    // All ranks have to use the same selection table.
+    template<typename T>
+    class AlltoallvLowLevel<T, AlltoallvAlgorithm::AUTO> : public AlltoallvCommon
+    {
+      public:
+        AlltoallvLowLevel(gaspi::group::Group const& group,
+                          std::vector<std::size_t> const& send_counts,
+                          std::vector<std::size_t> const& recv_counts);
+
+        AlltoallvAlgorithm getSelectedAlgorithm() const;
+
+      private:
+        AlltoallvAlgorithm selected_algorithm;
+        std::unique_ptr<AlltoallvCommon> alltoallv_impl;
+
+        void waitForSetupImpl() override;
+        void copyInImpl(void const*) override;
+        void copyOutImpl(void*) override;
+
+        void startImpl() override;
+        bool triggerProgressImpl() override;
+
+        static std::size_t get_message_bytes(gaspi::group::Group const& group,
+                                             std::size_t number_send_elements);
+        static std::unique_ptr<AlltoallvCommon> make_alltoallv(
+                                                  AlltoallvAlgorithm algorithm,
+                                                  gaspi::group::Group const& group,
+                                                  std::vector<std::size_t> const& send_counts,
+                                                  std::vector<std::size_t> const& recv_counts);
+    };
+
+    template<typename T>
+    AlltoallvLowLevel<T, AlltoallvAlgorithm::AUTO>::AlltoallvLowLevel(
+                      gaspi::group::Group const& group,
+                      std::vector<std::size_t> const& send_counts,
+                      std::vector<std::size_t> const& recv_counts)
+    : AlltoallvCommon(group, send_counts, recv_counts),
+      selected_algorithm(select_alltoallv_algorithm(
+                           group.size(), get_message_bytes(group, number_send_elements))),
+      alltoallv_impl(make_alltoallv(selected_algorithm, group, send_counts, recv_counts))
+    { }
+
+    // largest amount of data sent by any rank, such that all ranks agree
+    template<typename T>
+    std::size_t AlltoallvLowLevel<T, AlltoallvAlgorithm::AUTO>::get_message_bytes(
+                      gaspi::group::Group const& group,
+                      std::size_t number_send_elements)
+    {
+      auto const send_elements = allgather_counts(group, number_send_elements);
+      return sizeof(T) * *std::max_element(send_elements.begin(), send_elements.end());
+    }
+
+    template<typename T>
+    std::unique_ptr<AlltoallvCommon> AlltoallvLowLevel<T, AlltoallvAlgorithm::AUTO>::make_alltoallv(
+                      AlltoallvAlgorithm algorithm,
+                      gaspi::group::Group const& group,
+                      std::vector<std::size_t> const& send_counts,
+                      std::vector<std::size_t> const& recv_counts)
+    {
+      switch (algorithm)
+      {
+        case AlltoallvAlgorithm::PAIRWISE_EXCHANGE:
+        {
+          return std::make_unique<AlltoallvLowLevel<T, AlltoallvAlgorithm::PAIRWISE_EXCHANGE>>(
+                   group, send_counts, recv_counts);
+        }
+        case AlltoallvAlgorithm::BRUCK:
+        {
+          return std::make_unique<AlltoallvLowLevel<T, AlltoallvAlgorithm::BRUCK>>(
+                   group, send_counts, recv_counts);
+        }
+        default:
+        {
+          throw std::logic_error("AlltoallvLowLevel<AUTO>: Algorithm " +
+                                 AlltoallvInfo::names[algorithm] + " cannot be selected");
+        }
+      }
+    }
+
+    template<typename T>
+    void AlltoallvLowLevel<T, AlltoallvAlgorithm::AUTO>::waitForSetupImpl()
+    {
+      alltoallv_impl->waitForSetup();
+    }
+
+    template<typename T>
+    void AlltoallvLowLevel<T, AlltoallvAlgorithm::AUTO>::startImpl()
+    {
+      alltoallv_impl->start();
+    }
+
+    template<typename T>
+    bool AlltoallvLowLevel<T, AlltoallvAlgorithm::AUTO>::triggerProgressImpl()
+    {
+      return alltoallv_impl->triggerProgress();
+    }
+
+    template<typename T>
+    void AlltoallvLowLevel<T, AlltoallvAlgorithm::AUTO>::copyInImpl(void const* inputs)
+    {
+      alltoallv_impl->copyIn(inputs);
+    }
+
+    template<typename T>
+    void AlltoallvLowLevel<T, AlltoallvAlgorithm::AUTO>::copyOutImpl(void* outputs)
+    {
+      alltoallv_impl->copyOut(outputs);
+    }
+
+    template<typename T>
+    AlltoallvAlgorithm AlltoallvLowLevel<T, AlltoallvAlgorithm::AUTO>::getSelectedAlgorithm() const
+    {
+      return selected_algorithm;
+    }
+  }
+}
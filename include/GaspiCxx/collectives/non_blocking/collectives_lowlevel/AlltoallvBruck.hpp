@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * AlltoallvBruck.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllgathervCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AlltoallvCommon.hpp>
+#include <GaspiCxx/singlesided/write/SourceBuffer.hpp>
+#include <GaspiCxx/singlesided/write/TargetBuffer.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // Bruck's algorithm in ceil(log P) steps: the blocks are rotated such that
+    // block `i` is destined to rank `rank + i`, and in step `k` all blocks
+    // with bit `k` set in their index are sent to rank `rank + 2^k`.
+    // Afterwards, block `i` holds the data of rank `rank - i`.
+    //
+    // Each block is transferred up to log P times and padded to the largest
+    // block in the group (determined at construction), which makes it
+    // suited for small messages only.
+    template<typename T>
+    class AlltoallvLowLevel<T, AlltoallvAlgorithm::BRUCK> : public AlltoallvCommon
+    {
+      using SourceBuffer = gaspi::singlesided::write::SourceBuffer;
+      using TargetBuffer = gaspi::singlesided::write::TargetBuffer;
+      using ConnectHandle = gaspi::singlesided::Endpoint::ConnectHandle;
+
+      public:
+        AlltoallvLowLevel(gaspi::group::Group const& group,
+                          std::vector<std::size_t> const& send_counts,
+                          std::vector<std::size_t> const& recv_counts);
+
+      private:
+        std::size_t number_ranks;
+        gaspi::group::Rank rank;
+        std::size_t block_size;
+        // rotated and padded blocks
+        std::vector<T> blocks;
+
+        // blocks sent in each step, and one buffer per step
+        std::vector<std::vector<std::size_t>> step_blocks;
+        std::vector<std::unique_ptr<SourceBuffer>> source_buffers;
+        std::vector<std::unique_ptr<TargetBuffer>> target_buffers;
+        std::vector<ConnectHandle> handles;
+
+        std::size_t current_step;
+        std::vector<bool> is_acknowledged;
+        std::size_t number_acknowledged;
+
+        void waitForSetupImpl() override;
+        void copyInImpl(void const*) override;
+        void copyOutImpl(void*) override;
+
+        void startImpl() override;
+        bool triggerProgressImpl() override;
+
+        bool is_last_step() const;
+        void pack_and_send();
+        void unpack();
+
+        static std::size_t get_block_size(gaspi::group::Group const& group,
+                                          std::vector<std::size_t> const& send_counts);
+    };
+
+    template<typename T>
+    AlltoallvLowLevel<T, AlltoallvAlgorithm::BRUCK>::AlltoallvLowLevel(
+                      gaspi::group::Group const& group,
+                      std::vector<std::size_t> const& send_counts,
+                      std::vector<std::size_t> const& recv_counts)
+    : AlltoallvCommon(group, send_counts, recv_counts),
+      number_ranks(group.size()),
+      rank(group.rank()),
+      block_size(get_block_size(group, send_counts)),
+      blocks(number_ranks * block_size),
+      step_blocks(),
+      source_buffers(),
+      target_buffers(),
+      handles(),
+      current_step(0),
+      is_acknowledged(),
+      number_acknowledged(0)
+    {
+      for (auto distance = 1UL; distance < number_ranks; distance <<= 1)
+      {
+        std::vector<std::size_t> indices;
+        for (auto i = 0UL; i < number_ranks; ++i)
+        {
+          if (i & distance) { indices.push_back(i); }
+        }
+        step_blocks.push_back(indices);
+
+        auto const size_bytes = sizeof(T) * block_size * indices.size();
+        source_buffers.push_back(std::make_unique<SourceBuffer>(size_bytes));
+        target_buffers.push_back(std::make_unique<TargetBuffer>(size_bytes));
+
+        gaspi::group::Rank const destination((rank.get() + distance) % number_ranks);
+        gaspi::group::Rank const source((rank.get() + number_ranks - distance) % number_ranks);
+        SourceBuffer::Tag const tag = step_blocks.size() - 1;
+        handles.push_back(source_buffers.back()->connectToRemoteTarget(group, destination, tag));
+        handles.push_back(target_buffers.back()->connectToRemoteSource(group, source, tag));
+      }
+      is_acknowledged.resize(source_buffers.size(), false);
+      current_step = source_buffers.size();
+    }
+
+    // largest block sent by any rank
+    template<typename T>
+    std::size_t AlltoallvLowLevel<T, AlltoallvAlgorithm::BRUCK>::get_block_size(
+                  gaspi::group::Group const& group,
+                  std::vector<std::size_t> const& send_counts)
+    {
+      auto const local_block_size = send_counts.empty() ? 0UL :
+                                    *std::max_element(send_counts.begin(), send_counts.end());
+      auto const block_sizes = allgather_counts(group, local_block_size);
+      return *std::max_element(block_sizes.begin(), block_sizes.end());
+    }
+
+    template<typename T>
+    void AlltoallvLowLevel<T, AlltoallvAlgorithm::BRUCK>::waitForSetupImpl()
+    {
+      for (auto& handle : handles)
+      {
+        handle.waitForCompletion();
+      }
+    }
+
+    template<typename T>
+    void AlltoallvLowLevel<T, AlltoallvAlgorithm::BRUCK>::startImpl()
+    {
+      std::fill(is_acknowledged.begin(), is_acknowledged.end(), false);
+      number_acknowledged = 0;
+      current_step = 0;
+      if (!is_last_step())
+      {
+        pack_and_send();
+      }
+    }
+
+    template<typename T>
+    bool AlltoallvLowLevel<T, AlltoallvAlgorithm::BRUCK>::triggerProgressImpl()
+    {
+      while (!is_last_step())
+      {
+        if (!target_buffers[current_step]->checkForCompletion()) { return false; }
+        unpack();
+        target_buffers[current_step]->ackTransfer();
+
+        current_step++;
+        if (!is_last_step())
+        {
+          pack_and_send();
+        }
+      }
+
+      for (auto i = 0UL; i < source_buffers.size(); ++i)
+      {
+        if (is_acknowledged[i] || !source_buffers[i]->checkForTransferAck()) { continue; }
+
+        is_acknowledged[i] = true;
+        number_acknowledged++;
+      }
+      return number_acknowledged == source_buffers.size();
+    }
+
+    template<typename T>
+    void AlltoallvLowLevel<T, AlltoallvAlgorithm::BRUCK>::copyInImpl(void const* inputs)
+    {
+      auto const begin = static_cast<T const*>(inputs);
+      for (auto i = 0UL; i < number_ranks; ++i)
+      {
+        auto const destination = (rank.get() + i) % number_ranks;
+        std::copy(begin + send_offsets[destination],
+                  begin + send_offsets[destination] + send_counts[destination],
+                  blocks.begin() + i * block_size);
+      }
+    }
+
+    template<typename T>
+    void AlltoallvLowLevel<T, AlltoallvAlgorithm::BRUCK>::copyOutImpl(void* outputs)
+    {
+      auto const begin = static_cast<T*>(outputs);
+      for (auto i = 0UL; i < number_ranks; ++i)
+      {
+        auto const source = (rank.get() + number_ranks - i) % number_ranks;
+        auto const block = blocks.begin() + i * block_size;
+        std::copy(block, block + recv_counts[source], begin + recv_offsets[source]);
+      }
+    }
+
+    template<typename T>
+    bool AlltoallvLowLevel<T, AlltoallvAlgorithm::BRUCK>::is_last_step() const
+    {
+      return current_step >= source_buffers.size();
+    }
+
+    template<typename T>
+    void AlltoallvLowLevel<T, AlltoallvAlgorithm::BRUCK>::pack_and_send()
+    {
+      auto packed = static_cast<T*>(source_buffers[current_step]->address());
+      for (auto const i : step_blocks[current_step])
+      {
+        packed = std::copy(blocks.begin() + i * block_size,
+                           blocks.begin() + (i + 1) * block_size, packed);
+      }
+      source_buffers[current_step]->initTransfer();
+    }
+
+    template<typename T>
+    void AlltoallvLowLevel<T, AlltoallvAlgorithm::BRUCK>::unpack()
+    {
+      auto packed = static_cast<T const*>(target_buffers[current_step]->address());
+      for (auto const i : step_blocks[current_step])
+      {
+        std::copy(packed, packed + block_size, blocks.begin() + i * block_size);
+        packed += block_size;
+      }
+    }
+  }
+}
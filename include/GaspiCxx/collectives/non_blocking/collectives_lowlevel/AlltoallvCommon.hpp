@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * AlltoallvCommon.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/CollectiveLowLevel.hpp>
+#include <GaspiCxx/group/Group.hpp>
+
+#include <array>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    class AlltoallvInfo
+    {
+      public:
+        enum class Algorithm
+        {
+          PAIRWISE_EXCHANGE,
+          BRUCK,
+          AUTO,
+        };
+        static inline std::unordered_map<Algorithm, std::string> names
+                      { {Algorithm::PAIRWISE_EXCHANGE, "pairwiseexchange" },
+                        {Algorithm::BRUCK, "bruck" },
+                        {Algorithm::AUTO, "auto" } };
+        static inline constexpr std::array<Algorithm, 3> implemented
+                      { Algorithm::PAIRWISE_EXCHANGE, Algorithm::BRUCK, Algorithm::AUTO };
+    };
+    using AlltoallvAlgorithm = AlltoallvInfo::Algorithm;
+
+    // Each rank sends `send_counts[i]` elements to rank `i`, and receives
+    // `recv_counts[i]` elements from rank `i`.
+    // Inputs and outputs are the concatenated blocks in the order of the ranks.
+    class AlltoallvCommon : public CollectiveLowLevel
+    {
+      public:
+        AlltoallvCommon(gaspi::group::Group const& group,
+                        std::vector<std::size_t> const& send_counts,
+                        std::vector<std::size_t> const& recv_counts);
+        virtual ~AlltoallvCommon() = default;
+
+        std::size_t getOutputCount() override;
+
+      protected:
+        gaspi::group::Group group;
+        std::vector<std::size_t> send_counts;
+        std::vector<std::size_t> send_offsets;
+        std::vector<std::size_t> recv_counts;
+        std::vector<std::size_t> recv_offsets;
+        std::size_t number_send_elements;
+        std::size_t number_recv_elements;
+    };
+
+    template<typename T, AlltoallvAlgorithm Algorithm>
+    class AlltoallvLowLevel : public AlltoallvCommon
+    { };
+
+    // Exchanges the `send_counts` of all ranks in the `group`, and returns
+    // the number of elements received from each rank (collective call)
+    std::vector<std::size_t> alltoall_counts(gaspi::group::Group const& group,
+                                             std::vector<std::size_t> const& send_counts);
+  }
+}
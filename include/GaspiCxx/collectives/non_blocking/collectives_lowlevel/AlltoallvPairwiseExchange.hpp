@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * AlltoallvPairwiseExchange.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AlltoallvCommon.hpp>
+#include <GaspiCxx/singlesided/write/SourceBuffer.hpp>
+#include <GaspiCxx/singlesided/write/TargetBuffer.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // Pairwise exchange in P-1 steps, in which each rank sends its block
+    // for rank `rank + s` and receives the block from rank `rank - s`
+    // in step `s`. A step only starts once the previous block is received,
+    // such that each rank has a single message in flight.
+    // The blocks are written directly from the input buffer, which makes it
+    // suited for large messages. Received blocks are acknowledged once they
+    // are stored locally, such that the next run may overwrite them.
+    template<typename T>
+    class AlltoallvLowLevel<T, AlltoallvAlgorithm::PAIRWISE_EXCHANGE> : public AlltoallvCommon
+    {
+      using SourceBuffer = gaspi::singlesided::write::SourceBuffer;
+      using TargetBuffer = gaspi::singlesided::write::TargetBuffer;
+      using ConnectHandle = gaspi::singlesided::Endpoint::ConnectHandle;
+
+      public:
+        AlltoallvLowLevel(gaspi::group::Group const& group,
+                          std::vector<std::size_t> const& send_counts,
+                          std::vector<std::size_t> const& recv_counts);
+
+      private:
+        std::size_t number_ranks;
+        gaspi::group::Rank rank;
+
+        std::unique_ptr<SourceBuffer> input_buffer;
+        std::vector<T> received_blocks;
+        // one buffer per step `s`, at index `s-1` (sources within the input buffer)
+        std::vector<std::unique_ptr<SourceBuffer>> source_buffers;
+        std::vector<std::unique_ptr<TargetBuffer>> target_buffers;
+        std::vector<ConnectHandle> handles;
+
+        std::size_t current_step;
+        std::vector<bool> is_acknowledged;
+        std::size_t number_acknowledged;
+
+        void waitForSetupImpl() override;
+        void copyInImpl(void const*) override;
+        void copyOutImpl(void*) override;
+
+        void startImpl() override;
+        bool triggerProgressImpl() override;
+
+        bool is_last_step() const;
+    };
+
+    template<typename T>
+    AlltoallvLowLevel<T, AlltoallvAlgorithm::PAIRWISE_EXCHANGE>::AlltoallvLowLevel(
+                      gaspi::group::Group const& group,
+                      std::vector<std::size_t> const& send_counts,
+                      std::vector<std::size_t> const& recv_counts)
+    : AlltoallvCommon(group, send_counts, recv_counts),
+      number_ranks(group.size()),
+      rank(group.rank()),
+      input_buffer(),
+      received_blocks(number_recv_elements),
+      source_buffers(),
+      target_buffers(),
+      handles(),
+      current_step(number_ranks),
+      is_acknowledged(number_ranks - 1, false),
+      number_acknowledged(0)
+    {
+      auto const send_bytes = sizeof(T) * number_send_elements;
+      auto& input_segment = gaspi::getRuntime().getFreeSegment(send_bytes);
+      input_buffer = std::make_unique<SourceBuffer>(input_segment, send_bytes);
+
+      auto const inputs = static_cast<T*>(input_buffer->address());
+      for (auto step = 1UL; step < number_ranks; ++step)
+      {
+        gaspi::group::Rank const destination((rank.get() + step) % number_ranks);
+        gaspi::group::Rank const source((rank.get() + number_ranks - step) % number_ranks);
+
+        source_buffers.push_back(std::make_unique<SourceBuffer>(
+                                   inputs + send_offsets[destination.get()], input_segment,
+                                   sizeof(T) * send_counts[destination.get()]));
+        target_buffers.push_back(std::make_unique<TargetBuffer>(
+                                   sizeof(T) * recv_counts[source.get()]));
+
+        SourceBuffer::Tag const tag = step;
+        handles.push_back(source_buffers.back()->connectToRemoteTarget(group, destination, tag));
+        handles.push_back(target_buffers.back()->connectToRemoteSource(group, source, tag));
+      }
+    }
+
+    template<typename T>
+    void AlltoallvLowLevel<T, AlltoallvAlgorithm::PAIRWISE_EXCHANGE>::waitForSetupImpl()
+    {
+      for (auto& handle : handles)
+      {
+        handle.waitForCompletion();
+      }
+    }
+
+    template<typename T>
+    void AlltoallvLowLevel<T, AlltoallvAlgorithm::PAIRWISE_EXCHANGE>::startImpl()
+    {
+      std::fill(is_acknowledged.begin(), is_acknowledged.end(), false);
+      number_acknowledged = 0;
+      current_step = 1;
+      if (!is_last_step())
+      {
+        source_buffers[current_step - 1]->initTransfer();
+      }
+    }
+
+    template<typename T>
+    bool AlltoallvLowLevel<T, AlltoallvAlgorithm::PAIRWISE_EXCHANGE>::triggerProgressImpl()
+    {
+      while (!is_last_step())
+      {
+        auto& target_buffer = target_buffers[current_step - 1];
+        if (!target_buffer->checkForCompletion()) { return false; }
+
+        auto const source = (rank.get() + number_ranks - current_step) % number_ranks;
+        auto const received = static_cast<T const*>(target_buffer->address());
+        std::copy(received, received + recv_counts[source],
+                  received_blocks.begin() + recv_offsets[source]);
+        target_buffer->ackTransfer();
+
+        current_step++;
+        if (!is_last_step())
+        {
+          source_buffers[current_step - 1]->initTransfer();
+        }
+      }
+
+      for (auto i = 0UL; i < source_buffers.size(); ++i)
+      {
+        if (is_acknowledged[i] || !source_buffers[i]->checkForTransferAck()) { continue; }
+
+        is_acknowledged[i] = true;
+        number_acknowledged++;
+      }
+      return number_acknowledged == source_buffers.size();
+    }
+
+    template<typename T>
+    void AlltoallvLowLevel<T, AlltoallvAlgorithm::PAIRWISE_EXCHANGE>::copyInImpl(void const* inputs)
+    {
+      auto const begin = static_cast<T const*>(inputs);
+      std::copy(begin, begin + number_send_elements, static_cast<T*>(input_buffer->address()));
+    }
+
+    template<typename T>
+    void AlltoallvLowLevel<T, AlltoallvAlgorithm::PAIRWISE_EXCHANGE>::copyOutImpl(void* outputs)
+    {
+      auto const begin = static_cast<T*>(outputs);
+      std::copy(received_blocks.begin(), received_blocks.end(), begin);
+
+      // the own block is not transferred
+      auto const own_block = static_cast<T const*>(input_buffer->address()) + send_offsets[rank.get()];
+      std::copy(own_block, own_block + send_counts[rank.get()], begin + recv_offsets[rank.get()]);
+    }
+
+    template<typename T>
+    bool AlltoallvLowLevel<T, AlltoallvAlgorithm::PAIRWISE_EXCHANGE>::is_last_step() const
+    {
+      return current_step >= number_ranks;
+    }
+  }
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * BarrierCommon.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/CollectiveLowLevel.hpp>
+#include <GaspiCxx/group/Group.hpp>
+
+#include <array>
+#include <string>
+#include <unordered_map>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    class BarrierInfo
+    {
+      public:
+        enum class Algorithm
+        {
+          DISSEMINATION,
+        };
+        static inline std::unordered_map<Algorithm, std::string> names
+                      { {Algorithm::DISSEMINATION, "dissemination" } };
+        static inline constexpr std::array<Algorithm, 1> implemented
+                      { Algorithm::DISSEMINATION };
+    };
+    using BarrierAlgorithm = BarrierInfo::Algorithm;
+
+    // A barrier carries no data: `copyIn` and `copyOut` expect `NO_DATA`
+    class BarrierCommon : public CollectiveLowLevel
+    {
+      public:
+        BarrierCommon(gaspi::group::Group const& group);
+        virtual ~BarrierCommon() = default;
+        std::size_t getOutputCount() override;
+
+      protected:
+        gaspi::group::Group group;
+
+      private:
+        void copyInImpl(void const*) override;
+        void copyOutImpl(void*) override;
+    };
+
+    template<BarrierAlgorithm Algorithm>
+    class BarrierLowLevel : public BarrierCommon
+    { };
+  }
+}
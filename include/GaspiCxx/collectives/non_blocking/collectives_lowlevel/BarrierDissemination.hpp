@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * BarrierDissemination.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/BarrierCommon.hpp>
+#include <GaspiCxx/singlesided/write/SourceBuffer.hpp>
+#include <GaspiCxx/singlesided/write/TargetBuffer.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    /*
+     * DISSEMINATION BARRIER
+     * =====================
+     *
+     *   In step `k` (of ceil(log_2 p)), each rank notifies the rank at
+     *   distance 2^k and waits for the notification of the rank at
+     *   distance -2^k, as in `blocking::Barrier`.
+     *
+     *   Each call of `triggerProgress` only checks for notifications, such
+     *   that the barrier can be completed by a progress engine while the
+     *   ranks that entered it early keep computing. A step only waits for
+     *   the notification of the previous rank; the acknowledgements of the
+     *   sent notifications are collected before the barrier completes.
+     */
+    template<>
+    class BarrierLowLevel<BarrierAlgorithm::DISSEMINATION> : public BarrierCommon
+    {
+      using SourceBuffer = gaspi::singlesided::write::SourceBuffer;
+      using TargetBuffer = gaspi::singlesided::write::TargetBuffer;
+      using ConnectHandle = gaspi::singlesided::Endpoint::ConnectHandle;
+
+      public:
+        BarrierLowLevel(gaspi::group::Group const& group);
+
+      private:
+        std::vector<std::unique_ptr<SourceBuffer>> source_buffers;
+        std::vector<std::unique_ptr<TargetBuffer>> target_buffers;
+        std::vector<ConnectHandle> handles;
+
+        std::size_t step;
+        std::vector<bool> is_acknowledged;
+        std::size_t number_acknowledged;
+
+        void waitForSetupImpl() override;
+
+        void startImpl() override;
+        bool triggerProgressImpl() override;
+
+        void notify_next_rank();
+    };
+  }
+}
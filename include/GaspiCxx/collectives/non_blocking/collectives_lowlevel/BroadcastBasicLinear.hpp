@@ -51,14 +51,11 @@ namespace gaspi
         std::size_t number_ranks;
         gaspi::group::Rank rank;
         gaspi::group::Rank first;
-        gaspi::group::Rank rank_after_first;
-        gaspi::group::Rank second_last;
         gaspi::group::Rank last;
         gaspi::group::Rank left_neighbour;
         gaspi::group::Rank right_neighbour;
 
-        std::size_t iteration;
-        std::size_t last_iteration;
+        bool received;
         std::size_t buffer_size_bytes;
 
         std::unique_ptr<SourceBuffer> source_buffer;
@@ -84,13 +81,10 @@ namespace gaspi
       number_ranks(group.size()),
       rank(group.rank()),
       first(root),
-      rank_after_first((number_ranks + rank.get() - first.get()) % number_ranks),
-      second_last((number_ranks + first.get() - 2) % number_ranks),
       last((number_ranks + first.get() - 1) % number_ranks),
       left_neighbour((number_ranks + rank.get() - 1) % number_ranks),
       right_neighbour((number_ranks + rank.get() + 1) % number_ranks),
-      iteration(0UL),
-      last_iteration(number_ranks),
+      received(false),
       buffer_size_bytes(sizeof(T) * number_elements),
       source_buffer(),
       target_buffer(),
@@ -152,9 +146,8 @@ namespace gaspi
     {
       if (number_ranks == 1 || number_elements == 0) return;
 
-      iteration = 0;
+      received = (rank == first);
       if (rank == first) source_buffer->initTransfer();
-      iteration++;
     }
 
     template<typename T>
@@ -162,40 +155,31 @@ namespace gaspi
     {
       if (number_ranks == 1 || number_elements == 0) return true;
 
-      // After reaching `last_iteration` either wait for
-      // acknowledgment (`second_last` rank), or exit
-      // unconditionally
-      if (iteration == last_iteration)
-      {
-        auto done = true;
-        if (rank == second_last)
-        {
-          done = source_buffer->checkForTransferAck();
-        }
-        return done;
-      }
-
-      // Rank with position `iteration` after `first` receives data,
-      // and forwards it to the next rank, except if it is `last` rank,
-      // in which case, it sends acknowledgement to `second_last` instead
-      if (rank_after_first == group::Rank(iteration))
+      // Each rank receives the data from its left neighbour and forwards it
+      // to its right neighbour, except for the `last` rank
+      if (!received)
       {
         bool made_progress = target_buffer->checkForCompletion();
         if (!made_progress) { return false; }
+        received = true;
 
-        if (rank != last)
-        {
-          source_buffer->initTransfer();
-        }
-        else
+        if (rank == last)
         {
           target_buffer->ackTransfer();
+          return true;
         }
+        source_buffer->initTransfer();
       }
 
-      // Every rank goes to next iteration
-      iteration++;
-      return false;
+      // Acknowledgements travel back along the chain, such that a rank only
+      // overwrites the buffer of its right neighbour in the next run
+      // once the neighbour has forwarded the data
+      if (!source_buffer->checkForTransferAck()) { return false; }
+      if (rank != first)
+      {
+        target_buffer->ackTransfer();
+      }
+      return true;
     }
 
     template<typename T>
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * BroadcastBinomialTree.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/BroadcastCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/RootedTree.hpp>
+#include <GaspiCxx/singlesided/write/SourceBuffer.hpp>
+#include <GaspiCxx/singlesided/write/TargetBuffer.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // Broadcasts along a binomial tree (cf. `get_binomial_tree_node`) in
+    // log P steps. Each rank forwards the data to its children as soon as
+    // it is received, directly from the received buffer (i.e., using one
+    // source buffer per child on the same memory). Suited for small messages.
+    //
+    // A rank acknowledges the data of its parent only once it does not
+    // need it any more, i.e., after all children have acknowledged it and
+    // the data is copied out.
+    template<typename T>
+    class BroadcastLowLevel<T, BroadcastAlgorithm::BINOMIAL_TREE> : public BroadcastCommon
+    {
+      using SourceBuffer = gaspi::singlesided::write::SourceBuffer;
+      using TargetBuffer = gaspi::singlesided::write::TargetBuffer;
+      using Endpoint = gaspi::singlesided::Endpoint;
+      using ConnectHandle = Endpoint::ConnectHandle;
+
+      public:
+        BroadcastLowLevel(gaspi::group::Group const& group,
+                          std::size_t number_elements,
+                          gaspi::group::Rank const& root);
+
+      private:
+        gaspi::group::Rank rank;
+        std::size_t buffer_size_bytes;
+
+        // data copied in on the root, or received from the parent
+        std::unique_ptr<SourceBuffer> root_buffer;
+        std::unique_ptr<TargetBuffer> target_buffer;
+        // one buffer per child, on the memory of the data
+        std::vector<std::unique_ptr<SourceBuffer>> source_buffers;
+        std::vector<ConnectHandle> handles;
+
+        bool is_received;
+        std::vector<bool> is_child_acknowledged;
+        std::size_t number_children_acknowledged;
+
+        void waitForSetupImpl() override;
+        void copyInImpl(void const*) override;
+        void copyOutImpl(void*) override;
+
+        void startImpl() override;
+        bool triggerProgressImpl() override;
+
+        bool is_trivial() const;
+        void* get_data() const;
+        void send_to_children();
+    };
+
+    template<typename T>
+    BroadcastLowLevel<T, BroadcastAlgorithm::BINOMIAL_TREE>::BroadcastLowLevel(
+                      gaspi::group::Group const& group,
+                      std::size_t number_elements,
+                      gaspi::group::Rank const& root)
+    : BroadcastCommon(group, number_elements, root),
+      rank(group.rank()),
+      buffer_size_bytes(sizeof(T) * number_elements),
+      root_buffer(),
+      target_buffer(),
+      source_buffers(),
+      handles(),
+      is_received(false),
+      is_child_acknowledged(),
+      number_children_acknowledged(0)
+    {
+      if (!group.contains_rank(root))
+      {
+        throw std::logic_error(
+          "BroadcastLowLevel<T, BroadcastAlgorithm::BINOMIAL_TREE>: "
+          "`group` must contain `root`");
+      }
+      if (is_trivial()) { return; }
+
+      auto const node = get_binomial_tree_node(get_relative_rank(group, root), group.size());
+      auto& segment = gaspi::getRuntime().getFreeSegment(buffer_size_bytes);
+      if (rank == root)
+      {
+        root_buffer = std::make_unique<SourceBuffer>(segment, buffer_size_bytes);
+      }
+      else
+      {
+        target_buffer = std::make_unique<TargetBuffer>(segment, buffer_size_bytes);
+        TargetBuffer::Tag const tag = 0;
+        handles.push_back(target_buffer->connectToRemoteSource(
+                            group, get_group_rank(group, root, node.parent), tag));
+      }
+
+      Endpoint const& data_buffer = rank == root ? static_cast<Endpoint const&>(*root_buffer)
+                                                 : *target_buffer;
+      for (auto const child : node.children)
+      {
+        source_buffers.push_back(std::make_unique<SourceBuffer>(data_buffer));
+        SourceBuffer::Tag const tag = 0;
+        handles.push_back(source_buffers.back()->connectToRemoteTarget(
+                            group, get_group_rank(group, root, child), tag));
+      }
+      is_child_acknowledged.resize(source_buffers.size(), false);
+    }
+
+    template<typename T>
+    void BroadcastLowLevel<T, BroadcastAlgorithm::BINOMIAL_TREE>::waitForSetupImpl()
+    {
+      for (auto& handle : handles)
+      {
+        handle.waitForCompletion();
+      }
+    }
+
+    template<typename T>
+    void BroadcastLowLevel<T, BroadcastAlgorithm::BINOMIAL_TREE>::startImpl()
+    {
+      std::fill(is_child_acknowledged.begin(), is_child_acknowledged.end(), false);
+      number_children_acknowledged = 0;
+      is_received = (rank == root);
+
+      if (rank == root && !is_trivial())
+      {
+        send_to_children();
+      }
+    }
+
+    template<typename T>
+    bool BroadcastLowLevel<T, BroadcastAlgorithm::BINOMIAL_TREE>::triggerProgressImpl()
+    {
+      if (is_trivial()) { return true; }
+
+      if (!is_received)
+      {
+        if (!target_buffer->checkForCompletion()) { return false; }
+        is_received = true;
+        send_to_children();
+      }
+
+      for (auto i = 0UL; i < source_buffers.size(); ++i)
+      {
+        if (is_child_acknowledged[i] || !source_buffers[i]->checkForTransferAck()) { continue; }
+
+        is_child_acknowledged[i] = true;
+        number_children_acknowledged++;
+      }
+      return number_children_acknowledged == source_buffers.size();
+    }
+
+    template<typename T>
+    void BroadcastLowLevel<T, BroadcastAlgorithm::BINOMIAL_TREE>::copyInImpl(void const* inputs)
+    {
+      if (rank != root || is_trivial()) { return; }
+
+      std::memcpy(root_buffer->address(), inputs, buffer_size_bytes);
+    }
+
+    template<typename T>
+    void BroadcastLowLevel<T, BroadcastAlgorithm::BINOMIAL_TREE>::copyOutImpl(void* outputs)
+    {
+      if (is_trivial()) { return; }
+
+      std::memcpy(outputs, get_data(), buffer_size_bytes);
+      if (rank != root)
+      {
+        target_buffer->ackTransfer();
+      }
+    }
+
+    template<typename T>
+    bool BroadcastLowLevel<T, BroadcastAlgorithm::BINOMIAL_TREE>::is_trivial() const
+    {
+      return number_elements == 0;
+    }
+
+    template<typename T>
+    void* BroadcastLowLevel<T, BroadcastAlgorithm::BINOMIAL_TREE>::get_data() const
+    {
+      return rank == root ? root_buffer->address() : target_buffer->address();
+    }
+
+    template<typename T>
+    void BroadcastLowLevel<T, BroadcastAlgorithm::BINOMIAL_TREE>::send_to_children()
+    {
+      for (auto& source_buffer : source_buffers)
+      {
+        source_buffer->initTransfer();
+      }
+    }
+  }
+}
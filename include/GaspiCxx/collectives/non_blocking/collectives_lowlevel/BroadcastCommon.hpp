@@ -39,12 +39,20 @@ namespace gaspi
         {
           BASIC_LINEAR,
           SEND_TO_ALL,
+          BINOMIAL_TREE,
+          PIPELINED_CHAIN,
+          SCATTER_ALLGATHER,
         };
         static inline std::unordered_map<Algorithm, std::string> names
                       { {Algorithm::BASIC_LINEAR, "linear" },
-                        {Algorithm::SEND_TO_ALL, "sendtoall"} };
-        static inline constexpr std::array<Algorithm, 2> implemented
-                      { Algorithm::BASIC_LINEAR, Algorithm::SEND_TO_ALL};
+                        {Algorithm::SEND_TO_ALL, "sendtoall"},
+                        {Algorithm::BINOMIAL_TREE, "binomialtree"},
+                        {Algorithm::PIPELINED_CHAIN, "pipelinedchain"},
+                        {Algorithm::SCATTER_ALLGATHER, "scatterallgather"} };
+        static inline constexpr std::array<Algorithm, 5> implemented
+                      { Algorithm::BASIC_LINEAR, Algorithm::SEND_TO_ALL,
+                        Algorithm::BINOMIAL_TREE, Algorithm::PIPELINED_CHAIN,
+                        Algorithm::SCATTER_ALLGATHER};
     };
     using BroadcastAlgorithm = BroadcastInfo::Algorithm;
 
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * BroadcastPipelinedChain.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/BroadcastCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/Utilities.hpp>
+#include <GaspiCxx/singlesided/write/SourceBuffer.hpp>
+#include <GaspiCxx/singlesided/write/TargetBuffer.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // Runtime settings of the PIPELINED_CHAIN algorithm
+    struct BroadcastPipelinedChainSettings
+    {
+      // Maximum size of the chunks the data is split into
+      static inline std::size_t chunk_size_bytes = 256 * 1024;
+      // Larger messages use larger chunks, such that the number of
+      // buffers (and notifications) per rank stays bounded
+      static inline std::size_t max_number_chunks = 256;
+    };
+
+    // Ranks form a chain starting at `root` (as in BASIC_LINEAR), and the
+    // data is split into chunks. Each rank forwards a chunk to its successor
+    // as soon as it arrives, such that the chain works on up to P-1 chunks
+    // at a time. Suited for large messages.
+    //
+    // The chunks are received in place into one contiguous buffer. A rank
+    // acknowledges the chunks of its predecessor only once it does not need
+    // them any more, i.e., after its successor has acknowledged them and the
+    // data is copied out.
+    template<typename T>
+    class BroadcastLowLevel<T, BroadcastAlgorithm::PIPELINED_CHAIN> : public BroadcastCommon
+    {
+      using SourceBuffer = gaspi::singlesided::write::SourceBuffer;
+      using TargetBuffer = gaspi::singlesided::write::TargetBuffer;
+      using ConnectHandle = gaspi::singlesided::Endpoint::ConnectHandle;
+
+      public:
+        BroadcastLowLevel(gaspi::group::Group const& group,
+                          std::size_t number_elements,
+                          gaspi::group::Rank const& root,
+                          std::size_t chunk_size_bytes = BroadcastPipelinedChainSettings::chunk_size_bytes);
+
+      private:
+        std::size_t number_ranks;
+        gaspi::group::Rank rank;
+        bool has_predecessor;
+        bool has_successor;
+        std::size_t number_elements_chunk;
+        std::size_t number_chunks;
+
+        // all chunks, stored contiguously
+        std::unique_ptr<SourceBuffer> data_buffer;
+        // one buffer per chunk (within the data buffer)
+        std::vector<std::unique_ptr<SourceBuffer>> source_buffers;
+        std::vector<std::unique_ptr<TargetBuffer>> target_buffers;
+        std::vector<ConnectHandle> handles;
+
+        std::size_t current_chunk;
+        std::size_t number_chunks_acknowledged;
+
+        void waitForSetupImpl() override;
+        void copyInImpl(void const*) override;
+        void copyOutImpl(void*) override;
+
+        void startImpl() override;
+        bool triggerProgressImpl() override;
+
+        bool is_trivial() const;
+        std::size_t get_chunk_number_elements(std::size_t chunk) const;
+        static std::size_t get_number_elements_chunk(std::size_t number_elements,
+                                                     std::size_t chunk_size_bytes);
+    };
+
+    template<typename T>
+    BroadcastLowLevel<T, BroadcastAlgorithm::PIPELINED_CHAIN>::BroadcastLowLevel(
+                      gaspi::group::Group const& group,
+                      std::size_t number_elements,
+                      gaspi::group::Rank const& root,
+                      std::size_t chunk_size_bytes)
+    : BroadcastCommon(group, number_elements, root),
+      number_ranks(group.size()),
+      rank(group.rank()),
+      // the chain runs from `root` up to the rank before `root` (on the ring)
+      has_predecessor(rank != root),
+      has_successor(rank != gaspi::group::Rank((root.get() + number_ranks - 1) % number_ranks)),
+      number_elements_chunk(get_number_elements_chunk(number_elements, chunk_size_bytes)),
+      number_chunks(number_elements_chunk == 0 ? 0 :
+                    ceil_div(number_elements, number_elements_chunk)),
+      data_buffer(),
+      source_buffers(),
+      target_buffers(),
+      handles(),
+      current_chunk(0),
+      number_chunks_acknowledged(0)
+    {
+      if (!group.contains_rank(root))
+      {
+        throw std::logic_error(
+          "BroadcastLowLevel<T, BroadcastAlgorithm::PIPELINED_CHAIN>: "
+          "`group` must contain `root`");
+      }
+      if (number_elements == 0) { return; }
+
+      auto const size_bytes = sizeof(T) * number_elements;
+      auto& segment = gaspi::getRuntime().getFreeSegment(size_bytes);
+      data_buffer = std::make_unique<SourceBuffer>(segment, size_bytes);
+      if (number_ranks == 1) { return; }
+
+      gaspi::group::Rank const predecessor((rank.get() + number_ranks - 1) % number_ranks);
+      gaspi::group::Rank const successor((rank.get() + 1) % number_ranks);
+      auto const data = static_cast<T*>(data_buffer->address());
+      for (auto chunk = 0UL; chunk < number_chunks; ++chunk)
+      {
+        auto const chunk_begin = data + chunk * number_elements_chunk;
+        auto const chunk_bytes = sizeof(T) * get_chunk_number_elements(chunk);
+        if (has_predecessor)
+        {
+          TargetBuffer::Tag const tag = chunk;
+          target_buffers.push_back(std::make_unique<TargetBuffer>(
+                                     chunk_begin, segment, chunk_bytes));
+          handles.push_back(target_buffers.back()->connectToRemoteSource(
+                              group, predecessor, tag));
+        }
+        if (has_successor)
+        {
+          SourceBuffer::Tag const tag = chunk;
+          source_buffers.push_back(std::make_unique<SourceBuffer>(
+                                     chunk_begin, segment, chunk_bytes));
+          handles.push_back(source_buffers.back()->connectToRemoteTarget(
+                              group, successor, tag));
+        }
+      }
+    }
+
+    template<typename T>
+    void BroadcastLowLevel<T, BroadcastAlgorithm::PIPELINED_CHAIN>::waitForSetupImpl()
+    {
+      for (auto& handle : handles)
+      {
+        handle.waitForCompletion();
+      }
+    }
+
+    template<typename T>
+    void BroadcastLowLevel<T, BroadcastAlgorithm::PIPELINED_CHAIN>::startImpl()
+    {
+      current_chunk = 0;
+      number_chunks_acknowledged = 0;
+    }
+
+    template<typename T>
+    bool BroadcastLowLevel<T, BroadcastAlgorithm::PIPELINED_CHAIN>::triggerProgressImpl()
+    {
+      if (is_trivial()) { return true; }
+
+      while (current_chunk < number_chunks)
+      {
+        if (has_predecessor &&
+            !target_buffers[current_chunk]->checkForCompletion()) { return false; }
+        if (has_successor)
+        {
+          source_buffers[current_chunk]->initTransfer();
+        }
+        current_chunk++;
+      }
+
+      if (has_successor)
+      {
+        while (number_chunks_acknowledged < number_chunks)
+        {
+          if (!source_buffers[number_chunks_acknowledged]->checkForTransferAck()) { return false; }
+          number_chunks_acknowledged++;
+        }
+      }
+      return true;
+    }
+
+    template<typename T>
+    void BroadcastLowLevel<T, BroadcastAlgorithm::PIPELINED_CHAIN>::copyInImpl(void const* inputs)
+    {
+      if (rank != root || number_elements == 0) { return; }
+
+      std::memcpy(data_buffer->address(), inputs, sizeof(T) * number_elements);
+    }
+
+    template<typename T>
+    void BroadcastLowLevel<T, BroadcastAlgorithm::PIPELINED_CHAIN>::copyOutImpl(void* outputs)
+    {
+      if (number_elements == 0) { return; }
+
+      std::memcpy(outputs, data_buffer->address(), sizeof(T) * number_elements);
+      for (auto& target_buffer : target_buffers)
+      {
+        target_buffer->ackTransfer();
+      }
+    }
+
+    template<typename T>
+    bool BroadcastLowLevel<T, BroadcastAlgorithm::PIPELINED_CHAIN>::is_trivial() const
+    {
+      return number_ranks == 1 || number_elements == 0;
+    }
+
+    template<typename T>
+    std::size_t BroadcastLowLevel<T, BroadcastAlgorithm::PIPELINED_CHAIN>::get_chunk_number_elements(
+                  std::size_t chunk) const
+    {
+      return std::min(number_elements_chunk,
+                      number_elements - chunk * number_elements_chunk);
+    }
+
+    template<typename T>
+    std::size_t BroadcastLowLevel<T, BroadcastAlgorithm::PIPELINED_CHAIN>::get_number_elements_chunk(
+                  std::size_t number_elements,
+                  std::size_t chunk_size_bytes)
+    {
+      auto const max_number_chunks = std::max(BroadcastPipelinedChainSettings::max_number_chunks, 1UL);
+      auto const number_elements_chunk = std::max({chunk_size_bytes / sizeof(T), 1UL,
+                                                   ceil_div(number_elements, max_number_chunks)});
+      return std::min(number_elements_chunk, number_elements);
+    }
+  }
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * BroadcastScatterAllgather.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllgathervRing.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/BroadcastCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/ScattervBinomialTree.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // Van de Geijn's broadcast: the data of `root` is split into P (almost)
+    // equal parts, which are scattered along a binomial tree
+    // (cf. ScattervLowLevel<T, BINOMIAL_TREE>) and then gathered on all ranks
+    // along a ring (cf. AllgathervLowLevel<T, RING>).
+    // Each rank sends and receives about 2N elements, independently of P,
+    // such that the link of the root is no longer the bottleneck.
+    // Suited for large messages on large groups.
+    template<typename T>
+    class BroadcastLowLevel<T, BroadcastAlgorithm::SCATTER_ALLGATHER> : public BroadcastCommon
+    {
+      using Scatterv = ScattervLowLevel<T, ScattervAlgorithm::BINOMIAL_TREE>;
+      using Allgatherv = AllgathervLowLevel<T, AllgathervAlgorithm::RING>;
+
+      public:
+        BroadcastLowLevel(gaspi::group::Group const& group,
+                          std::size_t number_elements,
+                          gaspi::group::Rank const& root);
+
+      private:
+        enum class AlgStage
+        {
+          SCATTER,
+          ALLGATHER,
+        };
+
+        gaspi::group::Rank rank;
+        std::vector<std::size_t> counts;
+        // part of the data scattered to this rank
+        std::vector<T> part;
+
+        std::unique_ptr<Scatterv> scatterv;
+        std::unique_ptr<Allgatherv> allgatherv;
+        AlgStage alg_stage;
+
+        void waitForSetupImpl() override;
+        void copyInImpl(void const*) override;
+        void copyOutImpl(void*) override;
+
+        void startImpl() override;
+        bool triggerProgressImpl() override;
+
+        static std::vector<std::size_t> get_counts(std::size_t number_elements,
+                                                   std::size_t number_ranks);
+    };
+
+    template<typename T>
+    BroadcastLowLevel<T, BroadcastAlgorithm::SCATTER_ALLGATHER>::BroadcastLowLevel(
+                      gaspi::group::Group const& group,
+                      std::size_t number_elements,
+                      gaspi::group::Rank const& root)
+    : BroadcastCommon(group, number_elements, root),
+      rank(group.rank()),
+      counts(get_counts(number_elements, group.size())),
+      part(counts[rank.get()]),
+      scatterv(),
+      allgatherv(),
+      alg_stage(AlgStage::SCATTER)
+    {
+      if (!group.contains_rank(root))
+      {
+        throw std::logic_error(
+          "BroadcastLowLevel<T, BroadcastAlgorithm::SCATTER_ALLGATHER>: "
+          "`group` must contain `root`");
+      }
+      scatterv = std::make_unique<Scatterv>(group, counts, root);
+    }
+
+    template<typename T>
+    void BroadcastLowLevel<T, BroadcastAlgorithm::SCATTER_ALLGATHER>::waitForSetupImpl()
+    {
+      // both stages connect the same pairs of ranks with overlapping tags,
+      // so that the second one may only be connected after the first one
+      scatterv->waitForSetup();
+      allgatherv = std::make_unique<Allgatherv>(group, counts);
+      allgatherv->waitForSetup();
+    }
+
+    template<typename T>
+    void BroadcastLowLevel<T, BroadcastAlgorithm::SCATTER_ALLGATHER>::startImpl()
+    {
+      scatterv->start();
+      alg_stage = AlgStage::SCATTER;
+    }
+
+    template<typename T>
+    bool BroadcastLowLevel<T, BroadcastAlgorithm::SCATTER_ALLGATHER>::triggerProgressImpl()
+    {
+      if (alg_stage == AlgStage::SCATTER)
+      {
+        if (!scatterv->triggerProgress()) { return false; }
+
+        scatterv->copyOut(part.data());
+        allgatherv->copyIn(part.data());
+        allgatherv->start();
+        alg_stage = AlgStage::ALLGATHER;
+      }
+      return allgatherv->triggerProgress();
+    }
+
+    template<typename T>
+    void BroadcastLowLevel<T, BroadcastAlgorithm::SCATTER_ALLGATHER>::copyInImpl(void const* inputs)
+    {
+      scatterv->copyIn(rank == root ? inputs : CollectiveLowLevel::NO_DATA);
+    }
+
+    template<typename T>
+    void BroadcastLowLevel<T, BroadcastAlgorithm::SCATTER_ALLGATHER>::copyOutImpl(void* outputs)
+    {
+      allgatherv->copyOut(outputs);
+    }
+
+    template<typename T>
+    std::vector<std::size_t> BroadcastLowLevel<T, BroadcastAlgorithm::SCATTER_ALLGATHER>::get_counts(
+                  std::size_t number_elements,
+                  std::size_t number_ranks)
+    {
+      std::vector<std::size_t> counts(number_ranks, number_elements / number_ranks);
+      for (auto i = 0UL; i < number_elements % number_ranks; ++i)
+      {
+        ++counts[i];
+      }
+      return counts;
+    }
+  }
+}
@@ -0,0 +1,365 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Compression.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/Utilities.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // Lossy compression of floating point data
+    //
+    // TOP_K sends the (index, value) pairs of the elements with
+    // the largest magnitudes. QUANTIZATION_* sends each element as
+    // a signed 8-bit or 4-bit integer, scaled by the maximum magnitude
+    // of its block and rounded stochastically (i.e., without bias).
+    enum class CompressionMethod
+    {
+      TOP_K,
+      QUANTIZATION_8BIT,
+      QUANTIZATION_4BIT,
+    };
+
+    struct Compression
+    {
+      CompressionMethod method;
+      // Fraction of the elements selected by TOP_K
+      double top_k_ratio;
+      // Number of consecutive elements sharing a scale in QUANTIZATION_*
+      std::size_t quantization_block_size;
+    };
+
+    // Compresses a fixed number of elements into a payload
+    //
+    // Payload layouts:
+    //  - TOP_K: number of pairs `k` (uint32), `k` indices (uint32), `k` values
+    //  - QUANTIZATION_*: one scale (T) per block, followed by the packed codes
+    template<typename T>
+    class Compressor
+    {
+      static_assert(std::is_floating_point_v<T>,
+                    "Compressor: Only floating point elements can be compressed");
+
+      public:
+        Compressor(Compression const& compression,
+                   std::size_t number_elements,
+                   std::uint32_t seed);
+
+        std::size_t get_max_payload_size() const;
+        // Size of a payload created by `compress`
+        std::size_t get_payload_size(void const* payload) const;
+
+        // Writes the compressed `values` into `payload`, and adds
+        // the compression error (i.e., the difference between `values`
+        // and the decompressed payload) to `errors`.
+        // Returns the payload size in bytes.
+        std::size_t compress(T const* values, T* errors, void* payload);
+        void decompress(void const* payload, T* values) const;
+
+      private:
+        using Index = std::uint32_t;
+
+        Compression compression;
+        std::size_t number_elements;
+        std::size_t number_selected;
+        std::size_t number_quantization_blocks;
+        std::minstd_rand random_engine;
+        std::vector<Index> indices;
+
+        std::size_t get_bits_per_code() const;
+        std::size_t get_quantization_levels() const;
+
+        std::size_t compress_top_k(T const* values, T* errors, void* payload);
+        void decompress_top_k(void const* payload, T* values) const;
+        std::size_t compress_quantized(T const* values, T* errors, void* payload);
+        void decompress_quantized(void const* payload, T* values) const;
+
+        int get_code(std::uint8_t const* codes, std::size_t i) const;
+        void set_code(std::uint8_t* codes, std::size_t i, int code) const;
+    };
+
+    template<typename T>
+    Compressor<T>::Compressor(Compression const& compression,
+                              std::size_t number_elements,
+                              std::uint32_t seed)
+    : compression(compression),
+      number_elements(number_elements),
+      number_selected(0),
+      number_quantization_blocks(0),
+      random_engine(seed),
+      indices()
+    {
+      switch (compression.method)
+      {
+        case CompressionMethod::TOP_K:
+        {
+          if (!(compression.top_k_ratio > 0 && compression.top_k_ratio <= 1))
+          {
+            throw std::logic_error("Compressor: Top-k ratio has to be in (0, 1]");
+          }
+          auto const selected = static_cast<std::size_t>(
+            std::ceil(compression.top_k_ratio * static_cast<double>(number_elements)));
+          number_selected = std::min(std::max(selected, 1UL), number_elements);
+          indices.resize(number_elements);
+          break;
+        }
+        case CompressionMethod::QUANTIZATION_8BIT:
+        case CompressionMethod::QUANTIZATION_4BIT:
+        {
+          if (compression.quantization_block_size == 0)
+          {
+            throw std::logic_error("Compressor: Quantization block size has to be positive");
+          }
+          number_quantization_blocks = ceil_div(number_elements,
+                                                compression.quantization_block_size);
+        }
+      }
+    }
+
+    template<typename T>
+    std::size_t Compressor<T>::get_max_payload_size() const
+    {
+      if (compression.method == CompressionMethod::TOP_K)
+      {
+        return sizeof(Index) + number_selected * (sizeof(Index) + sizeof(T));
+      }
+      return number_quantization_blocks * sizeof(T)
+             + ceil_div(number_elements * get_bits_per_code(), 8UL);
+    }
+
+    template<typename T>
+    std::size_t Compressor<T>::get_payload_size(void const* payload) const
+    {
+      if (compression.method == CompressionMethod::TOP_K)
+      {
+        Index number_pairs;
+        std::memcpy(&number_pairs, payload, sizeof(Index));
+        return sizeof(Index) + number_pairs * (sizeof(Index) + sizeof(T));
+      }
+      return get_max_payload_size();
+    }
+
+    template<typename T>
+    std::size_t Compressor<T>::compress(T const* values, T* errors, void* payload)
+    {
+      if (compression.method == CompressionMethod::TOP_K)
+      {
+        return compress_top_k(values, errors, payload);
+      }
+      return compress_quantized(values, errors, payload);
+    }
+
+    template<typename T>
+    void Compressor<T>::decompress(void const* payload, T* values) const
+    {
+      if (compression.method == CompressionMethod::TOP_K)
+      {
+        decompress_top_k(payload, values);
+      }
+      else
+      {
+        decompress_quantized(payload, values);
+      }
+    }
+
+    template<typename T>
+    std::size_t Compressor<T>::get_bits_per_code() const
+    {
+      return compression.method == CompressionMethod::QUANTIZATION_8BIT ? 8 : 4;
+    }
+
+    template<typename T>
+    std::size_t Compressor<T>::get_quantization_levels() const
+    {
+      return (1UL << (get_bits_per_code() - 1)) - 1;
+    }
+
+    template<typename T>
+    std::size_t Compressor<T>::compress_top_k(T const* values, T* errors, void* payload)
+    {
+      if (number_elements == 0) { return 0; }
+
+      std::iota(indices.begin(), indices.end(), Index(0));
+      auto const is_larger = [values](Index a, Index b)
+                             { return std::abs(values[a]) > std::abs(values[b]); };
+      std::nth_element(indices.begin(), indices.begin() + (number_selected - 1),
+                       indices.end(), is_larger);
+
+      // zeros are not worth sending
+      auto const selected_end = std::partition(indices.begin(),
+                                                indices.begin() + number_selected,
+                                                [values](Index i) { return values[i] != T(0); });
+      std::sort(indices.begin(), selected_end);
+      auto const number_pairs = static_cast<Index>(selected_end - indices.begin());
+
+      auto const bytes = static_cast<char*>(payload);
+      auto const indices_begin = bytes + sizeof(Index);
+      auto const values_begin = indices_begin + number_pairs * sizeof(Index);
+      std::memcpy(bytes, &number_pairs, sizeof(Index));
+      std::memcpy(indices_begin, indices.data(), number_pairs * sizeof(Index));
+      for (auto i = 0UL; i < number_pairs; ++i)
+      {
+        std::memcpy(values_begin + i * sizeof(T), values + indices[i], sizeof(T));
+      }
+
+      // everything but the selected elements is lost
+      auto selected = indices.begin();
+      for (auto i = 0UL; i < number_elements; ++i)
+      {
+        if (selected != selected_end && *selected == i)
+        {
+          ++selected;
+          continue;
+        }
+        errors[i] += values[i];
+      }
+      return sizeof(Index) + number_pairs * (sizeof(Index) + sizeof(T));
+    }
+
+    template<typename T>
+    void Compressor<T>::decompress_top_k(void const* payload, T* values) const
+    {
+      if (number_elements == 0) { return; }
+
+      auto const bytes = static_cast<char const*>(payload);
+      Index number_pairs;
+      std::memcpy(&number_pairs, bytes, sizeof(Index));
+      auto const indices_begin = bytes + sizeof(Index);
+      auto const values_begin = indices_begin + number_pairs * sizeof(Index);
+
+      std::fill(values, values + number_elements, T(0));
+      for (auto i = 0UL; i < number_pairs; ++i)
+      {
+        Index index;
+        std::memcpy(&index, indices_begin + i * sizeof(Index), sizeof(Index));
+        std::memcpy(values + index, values_begin + i * sizeof(T), sizeof(T));
+      }
+    }
+
+    template<typename T>
+    std::size_t Compressor<T>::compress_quantized(T const* values, T* errors, void* payload)
+    {
+      auto const scales = static_cast<char*>(payload);
+      auto const codes = reinterpret_cast<std::uint8_t*>(
+                           scales + number_quantization_blocks * sizeof(T));
+      auto const levels = static_cast<T>(get_quantization_levels());
+      std::uniform_real_distribution<T> uniform(T(0), T(1));
+
+      for (auto block = 0UL; block < number_quantization_blocks; ++block)
+      {
+        auto const begin = block * compression.quantization_block_size;
+        auto const end = std::min(begin + compression.quantization_block_size,
+                                  number_elements);
+
+        T scale(0);
+        for (auto i = begin; i < end; ++i)
+        {
+          scale = std::max(scale, std::abs(values[i]));
+        }
+        std::memcpy(scales + block * sizeof(T), &scale, sizeof(T));
+
+        for (auto i = begin; i < end; ++i)
+        {
+          auto code = 0;
+          if (scale > T(0))
+          {
+            // rounds up with probability of the fractional part
+            auto const level = std::abs(values[i]) / scale * levels;
+            code = static_cast<int>(std::floor(level + uniform(random_engine)));
+            code = std::min(code, static_cast<int>(levels));
+            if (values[i] < T(0)) { code = -code; }
+          }
+          set_code(codes, i, code);
+          errors[i] += values[i] - static_cast<T>(code) * scale / levels;
+        }
+      }
+      return get_max_payload_size();
+    }
+
+    template<typename T>
+    void Compressor<T>::decompress_quantized(void const* payload, T* values) const
+    {
+      auto const scales = static_cast<char const*>(payload);
+      auto const codes = reinterpret_cast<std::uint8_t const*>(
+                           scales + number_quantization_blocks * sizeof(T));
+      auto const levels = static_cast<T>(get_quantization_levels());
+
+      for (auto block = 0UL; block < number_quantization_blocks; ++block)
+      {
+        auto const begin = block * compression.quantization_block_size;
+        auto const end = std::min(begin + compression.quantization_block_size,
+                                  number_elements);
+
+        T scale;
+        std::memcpy(&scale, scales + block * sizeof(T), sizeof(T));
+        for (auto i = begin; i < end; ++i)
+        {
+          values[i] = static_cast<T>(get_code(codes, i)) * scale / levels;
+        }
+      }
+    }
+
+    // 8-bit codes are stored as `int8_t`, 4-bit codes in [-7, 7]
+    // are stored with an offset of 8, two per byte
+    template<typename T>
+    int Compressor<T>::get_code(std::uint8_t const* codes, std::size_t i) const
+    {
+      if (get_bits_per_code() == 8)
+      {
+        return static_cast<std::int8_t>(codes[i]);
+      }
+      auto const nibble = (i % 2 == 0) ? (codes[i / 2] & 0xfU) : (codes[i / 2] >> 4);
+      return static_cast<int>(nibble) - 8;
+    }
+
+    template<typename T>
+    void Compressor<T>::set_code(std::uint8_t* codes, std::size_t i, int code) const
+    {
+      if (get_bits_per_code() == 8)
+      {
+        codes[i] = static_cast<std::uint8_t>(static_cast<std::int8_t>(code));
+        return;
+      }
+      auto const nibble = static_cast<std::uint8_t>(code + 8);
+      if (i % 2 == 0)
+      {
+        codes[i / 2] = nibble;
+      }
+      else
+      {
+        codes[i / 2] = static_cast<std::uint8_t>(codes[i / 2] | (nibble << 4));
+      }
+    }
+  }
+}
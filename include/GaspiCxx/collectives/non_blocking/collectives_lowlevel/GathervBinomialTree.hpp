@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * GathervBinomialTree.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/GathervCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/GathervTree.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/RootedTree.hpp>
+
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // Gathers along a binomial tree (cf. `get_binomial_tree_node`), such that
+    // the root receives log P messages instead of P-1.
+    // Suited for small messages.
+    template<typename T>
+    class GathervLowLevel<T, GathervAlgorithm::BINOMIAL_TREE> : public GathervTree<T>
+    {
+      public:
+        GathervLowLevel(gaspi::group::Group const& group,
+                        std::vector<std::size_t> const& counts,
+                        gaspi::group::Rank const& root);
+    };
+
+    template<typename T>
+    GathervLowLevel<T, GathervAlgorithm::BINOMIAL_TREE>::GathervLowLevel(
+                      gaspi::group::Group const& group,
+                      std::vector<std::size_t> const& counts,
+                      gaspi::group::Rank const& root)
+    : GathervTree<T>(group, counts, root,
+                     get_binomial_tree_node(get_relative_rank(group, root), group.size()))
+    { }
+  }
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * GathervDirect.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/GathervCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/GathervTree.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/RootedTree.hpp>
+
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // Each rank writes its data directly into its part of the root's
+    // buffer, i.e., every byte is transferred only once.
+    // Suited for large messages.
+    template<typename T>
+    class GathervLowLevel<T, GathervAlgorithm::DIRECT> : public GathervTree<T>
+    {
+      public:
+        GathervLowLevel(gaspi::group::Group const& group,
+                        std::vector<std::size_t> const& counts,
+                        gaspi::group::Rank const& root);
+    };
+
+    template<typename T>
+    GathervLowLevel<T, GathervAlgorithm::DIRECT>::GathervLowLevel(
+                      gaspi::group::Group const& group,
+                      std::vector<std::size_t> const& counts,
+                      gaspi::group::Rank const& root)
+    : GathervTree<T>(group, counts, root,
+                     get_flat_tree_node(get_relative_rank(group, root), group.size()))
+    { }
+  }
+}
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * GathervTree.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/GathervCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/RootedTree.hpp>
+#include <GaspiCxx/singlesided/write/SourceBuffer.hpp>
+#include <GaspiCxx/singlesided/write/TargetBuffer.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // Gathers along a tree given by the algorithm: each rank stores the data
+    // of its subtree contiguously (ordered by relative position), such that
+    // its children write their subtrees directly into its data buffer,
+    // from which it sends the whole subtree to its parent at once.
+    //
+    // A rank acknowledges the data of its children only once it does not
+    // need it any more, i.e., after its parent has acknowledged the subtree
+    // (or, on the root, after copying out the results).
+    template<typename T>
+    class GathervTree : public GathervCommon
+    {
+      using SourceBuffer = gaspi::singlesided::write::SourceBuffer;
+      using TargetBuffer = gaspi::singlesided::write::TargetBuffer;
+      using ConnectHandle = gaspi::singlesided::Endpoint::ConnectHandle;
+
+      protected:
+        GathervTree(gaspi::group::Group const& group,
+                    std::vector<std::size_t> const& counts,
+                    gaspi::group::Rank const& root,
+                    RootedTreeNode const& node);
+
+      private:
+        std::size_t number_ranks;
+        gaspi::group::Rank rank;
+        // offsets of the data of each relative position within the gathered data
+        std::vector<std::size_t> relative_offsets;
+
+        std::unique_ptr<SourceBuffer> data_buffer;
+        // one buffer per child, within `data_buffer`
+        std::vector<std::unique_ptr<TargetBuffer>> target_buffers;
+        std::vector<ConnectHandle> handles;
+
+        std::vector<bool> is_child_received;
+        std::size_t number_children_received;
+        bool is_sent;
+
+        void waitForSetupImpl() override;
+        void copyInImpl(void const*) override;
+        void copyOutImpl(void*) override;
+
+        void startImpl() override;
+        bool triggerProgressImpl() override;
+
+        bool is_trivial() const;
+        gaspi::group::Rank to_group_rank(std::size_t relative_rank) const;
+        void acknowledge_children();
+    };
+
+    template<typename T>
+    GathervTree<T>::GathervTree(gaspi::group::Group const& group,
+                                std::vector<std::size_t> const& counts,
+                                gaspi::group::Rank const& root,
+                                RootedTreeNode const& node)
+    : GathervCommon(group, counts, root),
+      number_ranks(group.size()),
+      rank(group.rank()),
+      relative_offsets(number_ranks + 1, 0),
+      data_buffer(),
+      target_buffers(),
+      handles(),
+      is_child_received(node.children.size(), false),
+      number_children_received(0),
+      is_sent(false)
+    {
+      for (auto i = 0UL; i < number_ranks; ++i)
+      {
+        relative_offsets[i + 1] = relative_offsets[i] + counts[to_group_rank(i).get()];
+      }
+      if (is_trivial()) { return; }
+
+      auto const relative_rank = get_relative_rank(group, root);
+      auto const subtree_begin = relative_offsets[relative_rank];
+      auto const size_bytes = sizeof(T) * (relative_offsets[node.subtree_end] - subtree_begin);
+      auto& segment = gaspi::getRuntime().getFreeSegment(size_bytes);
+      data_buffer = std::make_unique<SourceBuffer>(segment, size_bytes);
+
+      for (auto i = 0UL; i < node.children.size(); ++i)
+      {
+        auto const child = node.children[i];
+        auto const child_end = i + 1 < node.children.size() ? node.children[i + 1]
+                                                            : node.subtree_end;
+        auto const begin = static_cast<T*>(data_buffer->address())
+                           + relative_offsets[child] - subtree_begin;
+        target_buffers.push_back(std::make_unique<TargetBuffer>(
+                                   begin, segment,
+                                   sizeof(T) * (relative_offsets[child_end] - relative_offsets[child])));
+
+        TargetBuffer::Tag const tag = 0;
+        handles.push_back(target_buffers.back()->connectToRemoteSource(
+                            group, to_group_rank(child), tag));
+      }
+
+      if (rank != root)
+      {
+        SourceBuffer::Tag const tag = 0;
+        handles.push_back(data_buffer->connectToRemoteTarget(
+                            group, to_group_rank(node.parent), tag));
+      }
+    }
+
+    template<typename T>
+    void GathervTree<T>::waitForSetupImpl()
+    {
+      for (auto& handle : handles)
+      {
+        handle.waitForCompletion();
+      }
+    }
+
+    template<typename T>
+    void GathervTree<T>::startImpl()
+    {
+      std::fill(is_child_received.begin(), is_child_received.end(), false);
+      number_children_received = 0;
+      is_sent = false;
+    }
+
+    template<typename T>
+    bool GathervTree<T>::triggerProgressImpl()
+    {
+      if (is_trivial()) { return true; }
+
+      for (auto i = 0UL; i < target_buffers.size(); ++i)
+      {
+        if (is_child_received[i] || !target_buffers[i]->checkForCompletion()) { continue; }
+
+        is_child_received[i] = true;
+        number_children_received++;
+      }
+      if (number_children_received < target_buffers.size()) { return false; }
+      if (rank == root) { return true; }
+
+      if (!is_sent)
+      {
+        data_buffer->initTransfer();
+        is_sent = true;
+      }
+      if (!data_buffer->checkForTransferAck()) { return false; }
+
+      acknowledge_children();
+      return true;
+    }
+
+    template<typename T>
+    void GathervTree<T>::copyInImpl(void const* inputs)
+    {
+      if (is_trivial()) { return; }
+
+      auto const begin = static_cast<T const*>(inputs);
+      std::copy(begin, begin + counts[rank.get()], static_cast<T*>(data_buffer->address()));
+    }
+
+    template<typename T>
+    void GathervTree<T>::copyOutImpl(void* outputs)
+    {
+      if (rank != root || is_trivial()) { return; }
+
+      // reorder from relative positions to ranks
+      auto const data = static_cast<T const*>(data_buffer->address());
+      for (auto i = 0UL; i < number_ranks; ++i)
+      {
+        auto const group_rank = to_group_rank(i).get();
+        std::copy(data + relative_offsets[i], data + relative_offsets[i + 1],
+                  static_cast<T*>(outputs) + offsets[group_rank]);
+      }
+      acknowledge_children();
+    }
+
+    template<typename T>
+    bool GathervTree<T>::is_trivial() const
+    {
+      return number_elements == 0;
+    }
+
+    template<typename T>
+    gaspi::group::Rank GathervTree<T>::to_group_rank(std::size_t relative_rank) const
+    {
+      return get_group_rank(group, root, relative_rank);
+    }
+
+    template<typename T>
+    void GathervTree<T>::acknowledge_children()
+    {
+      for (auto& target_buffer : target_buffers)
+      {
+        target_buffer->ackTransfer();
+      }
+    }
+  }
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * HalfPrecision.hpp
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    namespace
+    {
+      inline std::uint32_t float_to_bits(float value)
+      {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+      }
+
+      inline float bits_to_float(std::uint32_t bits)
+      {
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+      }
+    }
+
+    // 16-bit storage types for floating point values, which are only used to
+    // store and transfer data; arithmetic is done after conversion to `float`.
+    // Conversions from `float` round to nearest even.
+
+    // IEEE 754 half precision (1 sign, 5 exponent, 10 mantissa bits)
+    class float16
+    {
+      public:
+        float16() = default;
+
+        explicit float16(float value)
+        : bits(from_float(value))
+        { }
+
+        explicit operator float() const
+        {
+          auto const shifted_exponent = 0x7c00U << 13;
+          auto result = (bits & 0x7fffU) << 13;
+          auto const exponent = result & shifted_exponent;
+
+          result += (127U - 15U) << 23;        // exponent adjustment
+          if (exponent == shifted_exponent)    // Inf/NaN
+          {
+            result += (128U - 16U) << 23;
+          }
+          else if (exponent == 0)              // zero/subnormal
+          {
+            result += 1U << 23;
+            result = float_to_bits(bits_to_float(result) - bits_to_float(113U << 23));
+          }
+          return bits_to_float(result | ((bits & 0x8000U) << 16));
+        }
+
+        bool operator==(float16 const& other) const
+        {
+          return static_cast<float>(*this) == static_cast<float>(other);
+        }
+
+      private:
+        std::uint16_t bits;
+
+        static std::uint16_t from_float(float value)
+        {
+          auto const float_infinity = 255U << 23;
+          auto const float16_max = (127U + 16U) << 23;
+          auto const subnormal_magic = ((127U - 15U) + (23U - 10U) + 1U) << 23;
+
+          auto absolute = float_to_bits(value);
+          auto const sign = absolute & 0x80000000U;
+          absolute ^= sign;
+
+          std::uint32_t result;
+          if (absolute >= float16_max)          // Inf/NaN
+          {
+            result = absolute > float_infinity ? 0x7e00U : 0x7c00U;
+          }
+          else if (absolute < (113U << 23))     // zero/subnormal
+          {
+            result = float_to_bits(bits_to_float(absolute) + bits_to_float(subnormal_magic))
+                     - subnormal_magic;
+          }
+          else
+          {
+            auto const mantissa_odd = (absolute >> 13) & 1U;
+            absolute += ((15U - 127U) << 23) + 0xfffU + mantissa_odd;
+            result = absolute >> 13;
+          }
+          return static_cast<std::uint16_t>(result | (sign >> 16));
+        }
+    };
+
+    // bfloat16 (1 sign, 8 exponent, 7 mantissa bits), i.e.,
+    // the upper half of a `float`
+    class bfloat16
+    {
+      public:
+        bfloat16() = default;
+
+        explicit bfloat16(float value)
+        : bits(from_float(value))
+        { }
+
+        explicit operator float() const
+        {
+          return bits_to_float(static_cast<std::uint32_t>(bits) << 16);
+        }
+
+        bool operator==(bfloat16 const& other) const
+        {
+          return static_cast<float>(*this) == static_cast<float>(other);
+        }
+
+      private:
+        std::uint16_t bits;
+
+        static std::uint16_t from_float(float value)
+        {
+          auto result = float_to_bits(value);
+          if ((result & 0x7fffffffU) > 0x7f800000U) // NaN, keep it quiet
+          {
+            return static_cast<std::uint16_t>((result >> 16) | 0x40U);
+          }
+          result += 0x7fffU + ((result >> 16) & 1U);
+          return static_cast<std::uint16_t>(result >> 16);
+        }
+    };
+  }
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * NeighborCommon.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/CollectiveLowLevel.hpp>
+#include <GaspiCxx/group/Group.hpp>
+
+#include <array>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    class NeighborInfo
+    {
+      public:
+        enum class Algorithm
+        {
+          DIRECT,
+        };
+        static inline std::unordered_map<Algorithm, std::string> names
+                      { {Algorithm::DIRECT, "direct" } };
+        static inline constexpr std::array<Algorithm, 1> implemented
+                      { Algorithm::DIRECT };
+    };
+    using NeighborAlgorithm = NeighborInfo::Algorithm;
+
+    // Communication graph as seen by one rank, which receives from each of
+    // the `sources` and sends to each of the `destinations` (in this order).
+    // Each edge has to be listed by both of its ranks. Multiple edges
+    // between the same pair of ranks are matched in the order of the lists.
+    struct NeighborGraph
+    {
+      std::vector<gaspi::group::Rank> sources;
+      std::vector<gaspi::group::Rank> destinations;
+    };
+
+    // Graph in which a rank sends to and receives from each of the `neighbors`
+    NeighborGraph make_symmetric_graph(std::vector<gaspi::group::Rank> const& neighbors);
+
+    // Each rank sends `send_counts[i]` elements to `destinations[i]`, and
+    // receives `recv_counts[i]` elements from `sources[i]`, which have to
+    // match the count sent along the same edge.
+    // Inputs and outputs are the concatenated blocks in the order of the graph.
+    class NeighborCommon : public CollectiveLowLevel
+    {
+      public:
+        NeighborCommon(gaspi::group::Group const& group,
+                       NeighborGraph const& graph,
+                       std::vector<std::size_t> const& send_counts,
+                       std::vector<std::size_t> const& send_offsets,
+                       std::vector<std::size_t> const& recv_counts);
+        virtual ~NeighborCommon() = default;
+
+        std::size_t getOutputCount() override;
+
+      protected:
+        gaspi::group::Group group;
+        NeighborGraph graph;
+        std::vector<std::size_t> send_counts;
+        std::vector<std::size_t> send_offsets;
+        std::vector<std::size_t> recv_counts;
+        std::vector<std::size_t> recv_offsets;
+        std::size_t number_send_elements;
+        std::size_t number_recv_elements;
+
+        // Offsets of the concatenated blocks
+        static std::vector<std::size_t> get_offsets(std::vector<std::size_t> const& counts);
+
+        // Index of each edge among the edges connecting the same pair of ranks
+        // in the same direction, such that both ranks agree on its tag
+        static std::vector<std::size_t> get_edge_tags(std::vector<gaspi::group::Rank> const& ranks);
+    };
+
+    template<typename T, NeighborAlgorithm Algorithm>
+    class NeighborAlltoallvLowLevel : public NeighborCommon
+    { };
+
+    // Each rank sends the same `count` elements to all its destinations
+    template<typename T, NeighborAlgorithm Algorithm>
+    class NeighborAllgatherLowLevel : public NeighborAlltoallvLowLevel<T, Algorithm>
+    { };
+  }
+}
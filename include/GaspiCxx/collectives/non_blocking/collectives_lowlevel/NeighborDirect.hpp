@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * NeighborDirect.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/NeighborCommon.hpp>
+#include <GaspiCxx/singlesided/write/SourceBuffer.hpp>
+#include <GaspiCxx/singlesided/write/TargetBuffer.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // All edges are connected once at setup and written concurrently
+    // in `start`, directly from the input buffer. Received blocks are
+    // acknowledged as soon as they are stored locally, such that the
+    // next run may overwrite them.
+    template<typename T>
+    class NeighborAlltoallvLowLevel<T, NeighborAlgorithm::DIRECT> : public NeighborCommon
+    {
+      using SourceBuffer = gaspi::singlesided::write::SourceBuffer;
+      using TargetBuffer = gaspi::singlesided::write::TargetBuffer;
+      using ConnectHandle = gaspi::singlesided::Endpoint::ConnectHandle;
+
+      public:
+        NeighborAlltoallvLowLevel(gaspi::group::Group const& group,
+                                  NeighborGraph const& graph,
+                                  std::vector<std::size_t> const& send_counts,
+                                  std::vector<std::size_t> const& recv_counts);
+
+      protected:
+        // blocks sent to `graph.destinations[i]` start at `send_offsets[i]`
+        NeighborAlltoallvLowLevel(gaspi::group::Group const& group,
+                                  NeighborGraph const& graph,
+                                  std::vector<std::size_t> const& send_counts,
+                                  std::vector<std::size_t> const& send_offsets,
+                                  std::vector<std::size_t> const& recv_counts);
+
+      private:
+        std::unique_ptr<SourceBuffer> input_buffer;
+        std::vector<T> received_blocks;
+        // one buffer per edge (sources within the input buffer)
+        std::vector<std::unique_ptr<SourceBuffer>> source_buffers;
+        std::vector<std::unique_ptr<TargetBuffer>> target_buffers;
+        std::vector<ConnectHandle> handles;
+
+        std::vector<bool> is_received;
+        std::size_t number_received;
+        std::vector<bool> is_acknowledged;
+        std::size_t number_acknowledged;
+
+        void waitForSetupImpl() override;
+        void copyInImpl(void const*) override;
+        void copyOutImpl(void*) override;
+
+        void startImpl() override;
+        bool triggerProgressImpl() override;
+    };
+
+    template<typename T>
+    class NeighborAllgatherLowLevel<T, NeighborAlgorithm::DIRECT>
+      : public NeighborAlltoallvLowLevel<T, NeighborAlgorithm::DIRECT>
+    {
+      public:
+        NeighborAllgatherLowLevel(gaspi::group::Group const& group,
+                                  NeighborGraph const& graph,
+                                  std::size_t count);
+    };
+
+    template<typename T>
+    NeighborAlltoallvLowLevel<T, NeighborAlgorithm::DIRECT>::NeighborAlltoallvLowLevel(
+                      gaspi::group::Group const& group,
+                      NeighborGraph const& graph,
+                      std::vector<std::size_t> const& send_counts,
+                      std::vector<std::size_t> const& recv_counts)
+    : NeighborAlltoallvLowLevel(group, graph, send_counts,
+                                get_offsets(send_counts), recv_counts)
+    { }
+
+    template<typename T>
+    NeighborAlltoallvLowLevel<T, NeighborAlgorithm::DIRECT>::NeighborAlltoallvLowLevel(
+                      gaspi::group::Group const& group,
+                      NeighborGraph const& graph,
+                      std::vector<std::size_t> const& send_counts,
+                      std::vector<std::size_t> const& send_offsets,
+                      std::vector<std::size_t> const& recv_counts)
+    : NeighborCommon(group, graph, send_counts, send_offsets, recv_counts),
+      input_buffer(),
+      received_blocks(number_recv_elements),
+      source_buffers(),
+      target_buffers(),
+      handles(),
+      is_received(graph.sources.size(), false),
+      number_received(graph.sources.size()),
+      is_acknowledged(graph.destinations.size(), false),
+      number_acknowledged(graph.destinations.size())
+    {
+      auto const send_bytes = sizeof(T) * number_send_elements;
+      auto& input_segment = gaspi::getRuntime().getFreeSegment(send_bytes);
+      input_buffer = std::make_unique<SourceBuffer>(input_segment, send_bytes);
+
+      auto const inputs = static_cast<T*>(input_buffer->address());
+      auto const destination_tags = get_edge_tags(graph.destinations);
+      for (auto i = 0UL; i < graph.destinations.size(); ++i)
+      {
+        source_buffers.push_back(std::make_unique<SourceBuffer>(
+                                   inputs + send_offsets[i], input_segment,
+                                   sizeof(T) * send_counts[i]));
+        handles.push_back(source_buffers.back()->connectToRemoteTarget(
+                            group, graph.destinations[i], SourceBuffer::Tag(destination_tags[i])));
+      }
+
+      auto const source_tags = get_edge_tags(graph.sources);
+      for (auto i = 0UL; i < graph.sources.size(); ++i)
+      {
+        target_buffers.push_back(std::make_unique<TargetBuffer>(sizeof(T) * recv_counts[i]));
+        handles.push_back(target_buffers.back()->connectToRemoteSource(
+                            group, graph.sources[i], TargetBuffer::Tag(source_tags[i])));
+      }
+    }
+
+    template<typename T>
+    void NeighborAlltoallvLowLevel<T, NeighborAlgorithm::DIRECT>::waitForSetupImpl()
+    {
+      for (auto& handle : handles)
+      {
+        handle.waitForCompletion();
+      }
+    }
+
+    template<typename T>
+    void NeighborAlltoallvLowLevel<T, NeighborAlgorithm::DIRECT>::startImpl()
+    {
+      std::fill(is_received.begin(), is_received.end(), false);
+      number_received = 0;
+      std::fill(is_acknowledged.begin(), is_acknowledged.end(), false);
+      number_acknowledged = 0;
+
+      for (auto& source_buffer : source_buffers)
+      {
+        source_buffer->initTransfer();
+      }
+    }
+
+    template<typename T>
+    bool NeighborAlltoallvLowLevel<T, NeighborAlgorithm::DIRECT>::triggerProgressImpl()
+    {
+      for (auto i = 0UL; i < target_buffers.size(); ++i)
+      {
+        if (is_received[i] || !target_buffers[i]->checkForCompletion()) { continue; }
+
+        auto const received = static_cast<T const*>(target_buffers[i]->address());
+        std::copy(received, received + recv_counts[i],
+                  received_blocks.begin() + recv_offsets[i]);
+        target_buffers[i]->ackTransfer();
+
+        is_received[i] = true;
+        number_received++;
+      }
+
+      for (auto i = 0UL; i < source_buffers.size(); ++i)
+      {
+        if (is_acknowledged[i] || !source_buffers[i]->checkForTransferAck()) { continue; }
+
+        is_acknowledged[i] = true;
+        number_acknowledged++;
+      }
+      return number_received == target_buffers.size() &&
+             number_acknowledged == source_buffers.size();
+    }
+
+    template<typename T>
+    void NeighborAlltoallvLowLevel<T, NeighborAlgorithm::DIRECT>::copyInImpl(void const* inputs)
+    {
+      auto const begin = static_cast<T const*>(inputs);
+      std::copy(begin, begin + number_send_elements, static_cast<T*>(input_buffer->address()));
+    }
+
+    template<typename T>
+    void NeighborAlltoallvLowLevel<T, NeighborAlgorithm::DIRECT>::copyOutImpl(void* outputs)
+    {
+      std::copy(received_blocks.begin(), received_blocks.end(), static_cast<T*>(outputs));
+    }
+
+    template<typename T>
+    NeighborAllgatherLowLevel<T, NeighborAlgorithm::DIRECT>::NeighborAllgatherLowLevel(
+                      gaspi::group::Group const& group,
+                      NeighborGraph const& graph,
+                      std::size_t count)
+    : NeighborAlltoallvLowLevel<T, NeighborAlgorithm::DIRECT>(
+        group, graph,
+        std::vector<std::size_t>(graph.destinations.size(), count),
+        std::vector<std::size_t>(graph.destinations.size(), 0),
+        std::vector<std::size_t>(graph.sources.size(), count))
+    { }
+  }
+}
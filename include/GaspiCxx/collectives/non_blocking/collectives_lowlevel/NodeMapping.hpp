@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * NodeMapping.hpp
+ *
+ */
+
+
+#pragma once
+
+#include <GaspiCxx/group/Group.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // Determines the compute node each rank of the `group` runs on,
+    // based on the host names of the ranks.
+    // Nodes are numbered consecutively in the order of their lowest rank.
+    //
+    // Collective call, i.e., it has to be invoked by all ranks in the group.
+    std::vector<std::size_t> get_node_ids(gaspi::group::Group const& group);
+  }
+}
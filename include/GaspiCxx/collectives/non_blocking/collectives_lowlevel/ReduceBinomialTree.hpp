@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ReduceBinomialTree.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/ReduceCommon.hpp>
+#include <GaspiCxx/singlesided/write/SourceBuffer.hpp>
+#include <GaspiCxx/singlesided/write/TargetBuffer.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // Ranks form a binomial tree rooted at `root` (of depth log P):
+    // each rank reduces the data of its children as soon as it arrives,
+    // and then sends the partial result to its parent.
+    template<typename T>
+    class ReduceLowLevel<T, ReduceAlgorithm::BINOMIAL_TREE> : public ReduceCommon
+    {
+      using SourceBuffer = gaspi::singlesided::write::SourceBuffer;
+      using TargetBuffer = gaspi::singlesided::write::TargetBuffer;
+      using ConnectHandle = gaspi::singlesided::Endpoint::ConnectHandle;
+
+      public:
+        using ReduceCommon::ReduceCommon;
+
+        ReduceLowLevel(gaspi::group::Group const& group,
+                       std::size_t number_elements,
+                       gaspi::group::Rank const& root,
+                       ReductionKernel<T> reduction_kernel);
+
+      private:
+        std::size_t number_ranks;
+        gaspi::group::Rank rank;
+
+        // partial results, sent to the parent
+        std::unique_ptr<SourceBuffer> data_buffer;
+        // one buffer per child
+        std::vector<std::unique_ptr<TargetBuffer>> target_buffers;
+        std::vector<ConnectHandle> handles;
+
+        std::vector<bool> is_child_received;
+        std::size_t number_children_received;
+        bool is_sent;
+
+        void waitForSetupImpl() override;
+        void copyInImpl(void const*) override;
+        void copyOutImpl(void*) override;
+
+        void startImpl() override;
+        bool triggerProgressImpl() override;
+
+        bool is_trivial() const;
+        gaspi::group::Rank to_group_rank(std::size_t relative_rank) const;
+    };
+
+    template<typename T>
+    ReduceLowLevel<T, ReduceAlgorithm::BINOMIAL_TREE>::ReduceLowLevel(
+                      gaspi::group::Group const& group,
+                      std::size_t number_elements,
+                      gaspi::group::Rank const& root,
+                      ReductionKernel<T> reduction_kernel)
+    : ReduceCommon(group, number_elements, root, reduction_kernel.get_untyped_kernel()),
+      number_ranks(group.size()),
+      rank(group.rank()),
+      data_buffer(),
+      target_buffers(),
+      handles(),
+      is_child_received(),
+      number_children_received(0),
+      is_sent(false)
+    {
+      if (number_elements == 0) { return; }
+
+      auto const size_bytes = sizeof(T) * number_elements;
+      data_buffer = std::make_unique<SourceBuffer>(size_bytes);
+      if (number_ranks == 1) { return; }
+
+      // The children of the rank at (root-relative) position `v` are
+      // `v + 2^i` for all `2^i` below the lowest set bit of `v`,
+      // whose connections are tagged by `i`.
+      auto const relative_rank = (number_ranks + rank.get() - root.get()) % number_ranks;
+      for (auto i = 0UL, mask = 1UL; mask < number_ranks; ++i, mask <<= 1)
+      {
+        if (relative_rank & mask)
+        {
+          SourceBuffer::Tag const tag = i;
+          handles.push_back(data_buffer->connectToRemoteTarget(
+                              group, to_group_rank(relative_rank - mask), tag));
+          break;
+        }
+        if (relative_rank + mask < number_ranks)
+        {
+          TargetBuffer::Tag const tag = i;
+          target_buffers.push_back(std::make_unique<TargetBuffer>(size_bytes));
+          handles.push_back(target_buffers.back()->connectToRemoteSource(
+                              group, to_group_rank(relative_rank + mask), tag));
+        }
+      }
+      is_child_received.resize(target_buffers.size());
+    }
+
+    template<typename T>
+    void ReduceLowLevel<T, ReduceAlgorithm::BINOMIAL_TREE>::waitForSetupImpl()
+    {
+      for (auto& handle : handles)
+      {
+        handle.waitForCompletion();
+      }
+    }
+
+    template<typename T>
+    void ReduceLowLevel<T, ReduceAlgorithm::BINOMIAL_TREE>::startImpl()
+    {
+      std::fill(is_child_received.begin(), is_child_received.end(), false);
+      number_children_received = 0;
+      is_sent = false;
+    }
+
+    template<typename T>
+    bool ReduceLowLevel<T, ReduceAlgorithm::BINOMIAL_TREE>::triggerProgressImpl()
+    {
+      if (is_trivial()) { return true; }
+
+      // the reduction is commutative, i.e., children are handled in
+      // the order their data arrives
+      for (auto i = 0UL; i < target_buffers.size(); ++i)
+      {
+        if (is_child_received[i] || !target_buffers[i]->checkForCompletion()) { continue; }
+
+        apply_reduce_op<T>(static_cast<T*>(data_buffer->address()),
+                           static_cast<T const*>(target_buffers[i]->address()),
+                           number_elements);
+        target_buffers[i]->ackTransfer();
+        is_child_received[i] = true;
+        number_children_received++;
+      }
+      if (number_children_received < target_buffers.size()) { return false; }
+      if (rank == root) { return true; }
+
+      // the inputs of the next run may only be copied in
+      // once the parent has received the partial results
+      if (!is_sent)
+      {
+        data_buffer->initTransfer();
+        is_sent = true;
+      }
+      return data_buffer->checkForTransferAck();
+    }
+
+    template<typename T>
+    void ReduceLowLevel<T, ReduceAlgorithm::BINOMIAL_TREE>::copyInImpl(void const* inputs)
+    {
+      if (number_elements == 0) { return; }
+
+      auto const begin = static_cast<T const*>(inputs);
+      std::copy(begin, begin + number_elements, static_cast<T*>(data_buffer->address()));
+    }
+
+    template<typename T>
+    void ReduceLowLevel<T, ReduceAlgorithm::BINOMIAL_TREE>::copyOutImpl(void* outputs)
+    {
+      if (rank != root || number_elements == 0) { return; }
+
+      auto const begin = static_cast<T const*>(data_buffer->address());
+      std::copy(begin, begin + number_elements, static_cast<T*>(outputs));
+    }
+
+    template<typename T>
+    bool ReduceLowLevel<T, ReduceAlgorithm::BINOMIAL_TREE>::is_trivial() const
+    {
+      return number_ranks == 1 || number_elements == 0;
+    }
+
+    template<typename T>
+    gaspi::group::Rank ReduceLowLevel<T, ReduceAlgorithm::BINOMIAL_TREE>::to_group_rank(
+                  std::size_t relative_rank) const
+    {
+      return gaspi::group::Rank((relative_rank + root.get()) % number_ranks);
+    }
+  }
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ReduceCommon.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/CollectiveLowLevel.hpp>
+#include <GaspiCxx/group/Group.hpp>
+
+#include <array>
+#include <string>
+#include <unordered_map>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    class ReduceInfo
+    {
+      public:
+        enum class Algorithm
+        {
+          BINOMIAL_TREE,
+          PIPELINED_CHAIN,
+        };
+        static inline std::unordered_map<Algorithm, std::string> names
+                      { {Algorithm::BINOMIAL_TREE, "binomialtree" },
+                        {Algorithm::PIPELINED_CHAIN, "pipelinedchain" } };
+        static inline constexpr std::array<Algorithm, 2> implemented
+                      { Algorithm::BINOMIAL_TREE, Algorithm::PIPELINED_CHAIN };
+    };
+    using ReduceAlgorithm = ReduceInfo::Algorithm;
+
+    // Reduces the inputs of all ranks into the outputs of the `root`.
+    // Only the root produces outputs, i.e., non-root ranks copy out `NO_DATA`.
+    class ReduceCommon : public CollectiveLowLevel
+    {
+      public:
+        ReduceCommon(gaspi::group::Group const& group,
+                     std::size_t number_elements,
+                     gaspi::group::Rank const& root,
+                     reduction::Kernel reduction_kernel);
+        virtual ~ReduceCommon() = default;
+
+        // `number_elements` on the root, zero otherwise
+        std::size_t getOutputCount() override;
+
+      protected:
+        gaspi::group::Group group;
+        std::size_t number_elements;
+        gaspi::group::Rank root;
+        reduction::Kernel reduction_kernel;
+
+        // Reduces `number_elements` values from `inputs` into `inouts`
+        template<typename T>
+        void apply_reduce_op(T* inouts, T const* inputs, std::size_t number_elements)
+        {
+          reduction_kernel(inouts, inputs, number_elements);
+        }
+    };
+
+    template<typename T, ReduceAlgorithm Algorithm>
+    class ReduceLowLevel : public ReduceCommon
+    { };
+  }
+}
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ReducePipelinedChain.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/ReduceCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/Utilities.hpp>
+#include <GaspiCxx/singlesided/write/SourceBuffer.hpp>
+#include <GaspiCxx/singlesided/write/TargetBuffer.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // Runtime settings of the PIPELINED_CHAIN algorithm
+    struct ReducePipelinedChainSettings
+    {
+      // Maximum size of the chunks the data is split into
+      static inline std::size_t chunk_size_bytes = 64 * 1024;
+    };
+
+    // Ranks form a chain ending at `root`: each rank reduces the chunks
+    // received from its predecessor into its own data and forwards each
+    // chunk to its successor as soon as it is reduced, such that the chain
+    // works on up to P chunks at a time.
+    template<typename T>
+    class ReduceLowLevel<T, ReduceAlgorithm::PIPELINED_CHAIN> : public ReduceCommon
+    {
+      using SourceBuffer = gaspi::singlesided::write::SourceBuffer;
+      using TargetBuffer = gaspi::singlesided::write::TargetBuffer;
+      using ConnectHandle = gaspi::singlesided::Endpoint::ConnectHandle;
+
+      public:
+        using ReduceCommon::ReduceCommon;
+
+        ReduceLowLevel(gaspi::group::Group const& group,
+                       std::size_t number_elements,
+                       gaspi::group::Rank const& root,
+                       ReductionKernel<T> reduction_kernel,
+                       std::size_t chunk_size_bytes = ReducePipelinedChainSettings::chunk_size_bytes);
+
+      private:
+        std::size_t number_ranks;
+        gaspi::group::Rank rank;
+        bool has_predecessor;
+        bool has_successor;
+        std::size_t number_elements_chunk;
+        std::size_t number_chunks;
+
+        // partial results of all chunks, stored contiguously
+        std::unique_ptr<SourceBuffer> data_buffer;
+        // one buffer per chunk
+        std::vector<std::unique_ptr<SourceBuffer>> source_buffers;
+        std::vector<std::unique_ptr<TargetBuffer>> target_buffers;
+        std::vector<ConnectHandle> handles;
+
+        std::size_t current_chunk;
+        std::size_t number_chunks_acknowledged;
+
+        void waitForSetupImpl() override;
+        void copyInImpl(void const*) override;
+        void copyOutImpl(void*) override;
+
+        void startImpl() override;
+        bool triggerProgressImpl() override;
+
+        bool is_trivial() const;
+        T* get_chunk_begin(std::size_t chunk) const;
+        std::size_t get_chunk_number_elements(std::size_t chunk) const;
+    };
+
+    template<typename T>
+    ReduceLowLevel<T, ReduceAlgorithm::PIPELINED_CHAIN>::ReduceLowLevel(
+                      gaspi::group::Group const& group,
+                      std::size_t number_elements,
+                      gaspi::group::Rank const& root,
+                      ReductionKernel<T> reduction_kernel,
+                      std::size_t chunk_size_bytes)
+    : ReduceCommon(group, number_elements, root, reduction_kernel.get_untyped_kernel()),
+      number_ranks(group.size()),
+      rank(group.rank()),
+      // the chain runs from the rank before `root` (on the ring) down to `root`
+      has_predecessor(rank != gaspi::group::Rank((root.get() + number_ranks - 1) % number_ranks)),
+      has_successor(rank != root),
+      number_elements_chunk(std::min(std::max(chunk_size_bytes / sizeof(T), 1UL),
+                                     number_elements)),
+      number_chunks(number_elements_chunk == 0 ? 0 :
+                    ceil_div(number_elements, number_elements_chunk)),
+      data_buffer(),
+      source_buffers(),
+      target_buffers(),
+      handles(),
+      current_chunk(0),
+      number_chunks_acknowledged(0)
+    {
+      if (number_elements == 0) { return; }
+
+      data_buffer = std::make_unique<SourceBuffer>(sizeof(T) * number_elements);
+      if (number_ranks == 1) { return; }
+
+      gaspi::group::Rank const predecessor((rank.get() + 1) % number_ranks);
+      gaspi::group::Rank const successor((rank.get() + number_ranks - 1) % number_ranks);
+      for (auto chunk = 0UL; chunk < number_chunks; ++chunk)
+      {
+        if (has_successor)
+        {
+          SourceBuffer::Tag const tag = chunk;
+          source_buffers.push_back(std::make_unique<SourceBuffer>(*data_buffer));
+          handles.push_back(source_buffers.back()->connectToRemoteTarget(
+                              group, successor, tag));
+        }
+        if (has_predecessor)
+        {
+          TargetBuffer::Tag const tag = chunk;
+          target_buffers.push_back(std::make_unique<TargetBuffer>(
+                                     sizeof(T) * get_chunk_number_elements(chunk)));
+          handles.push_back(target_buffers.back()->connectToRemoteSource(
+                              group, predecessor, tag));
+        }
+      }
+    }
+
+    template<typename T>
+    void ReduceLowLevel<T, ReduceAlgorithm::PIPELINED_CHAIN>::waitForSetupImpl()
+    {
+      for (auto& handle : handles)
+      {
+        handle.waitForCompletion();
+      }
+    }
+
+    template<typename T>
+    void ReduceLowLevel<T, ReduceAlgorithm::PIPELINED_CHAIN>::startImpl()
+    {
+      current_chunk = 0;
+      number_chunks_acknowledged = 0;
+    }
+
+    template<typename T>
+    bool ReduceLowLevel<T, ReduceAlgorithm::PIPELINED_CHAIN>::triggerProgressImpl()
+    {
+      if (is_trivial()) { return true; }
+
+      while (current_chunk < number_chunks)
+      {
+        if (has_predecessor)
+        {
+          if (!target_buffers[current_chunk]->checkForCompletion()) { return false; }
+
+          apply_reduce_op<T>(get_chunk_begin(current_chunk),
+                             static_cast<T const*>(target_buffers[current_chunk]->address()),
+                             get_chunk_number_elements(current_chunk));
+          target_buffers[current_chunk]->ackTransfer();
+        }
+        if (has_successor)
+        {
+          source_buffers[current_chunk]->initTransferPart(
+            sizeof(T) * get_chunk_number_elements(current_chunk),
+            sizeof(T) * current_chunk * number_elements_chunk);
+        }
+        current_chunk++;
+      }
+
+      // the inputs of the next run may only be copied in
+      // once the successor has reduced all chunks
+      if (has_successor)
+      {
+        while (number_chunks_acknowledged < number_chunks)
+        {
+          if (!source_buffers[number_chunks_acknowledged]->checkForTransferAck()) { return false; }
+          number_chunks_acknowledged++;
+        }
+      }
+      return true;
+    }
+
+    template<typename T>
+    void ReduceLowLevel<T, ReduceAlgorithm::PIPELINED_CHAIN>::copyInImpl(void const* inputs)
+    {
+      if (number_elements == 0) { return; }
+
+      auto const begin = static_cast<T const*>(inputs);
+      std::copy(begin, begin + number_elements, static_cast<T*>(data_buffer->address()));
+    }
+
+    template<typename T>
+    void ReduceLowLevel<T, ReduceAlgorithm::PIPELINED_CHAIN>::copyOutImpl(void* outputs)
+    {
+      if (rank != root || number_elements == 0) { return; }
+
+      auto const begin = static_cast<T const*>(data_buffer->address());
+      std::copy(begin, begin + number_elements, static_cast<T*>(outputs));
+    }
+
+    template<typename T>
+    bool ReduceLowLevel<T, ReduceAlgorithm::PIPELINED_CHAIN>::is_trivial() const
+    {
+      return number_ranks == 1 || number_elements == 0;
+    }
+
+    template<typename T>
+    T* ReduceLowLevel<T, ReduceAlgorithm::PIPELINED_CHAIN>::get_chunk_begin(
+                  std::size_t chunk) const
+    {
+      return static_cast<T*>(data_buffer->address()) + chunk * number_elements_chunk;
+    }
+
+    template<typename T>
+    std::size_t ReduceLowLevel<T, ReduceAlgorithm::PIPELINED_CHAIN>::get_chunk_number_elements(
+                  std::size_t chunk) const
+    {
+      return std::min(number_elements_chunk,
+                      number_elements - chunk * number_elements_chunk);
+    }
+  }
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ReduceScatterCommon.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/CollectiveLowLevel.hpp>
+#include <GaspiCxx/group/Group.hpp>
+
+#include <array>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    class ReduceScatterInfo
+    {
+      public:
+        enum class Algorithm
+        {
+          RING,
+        };
+        static inline std::unordered_map<Algorithm, std::string> names
+                      { {Algorithm::RING, "ring" } };
+        static inline constexpr std::array<Algorithm, 1> implemented
+                      { Algorithm::RING };
+    };
+    using ReduceScatterAlgorithm = ReduceScatterInfo::Algorithm;
+
+    // Reduces the inputs of all ranks, consisting of one block per rank
+    // (of `counts[i]` elements for rank `i`, stored contiguously),
+    // such that each rank obtains the reduced values of its own block
+    class ReduceScatterCommon : public CollectiveLowLevel
+    {
+      public:
+        ReduceScatterCommon(gaspi::group::Group const& group,
+                            std::vector<std::size_t> const& counts,
+                            reduction::Kernel reduction_kernel);
+        virtual ~ReduceScatterCommon() = default;
+        std::size_t getOutputCount() override;
+
+      protected:
+        gaspi::group::Group group;
+        std::vector<std::size_t> counts;
+        std::vector<std::size_t> offsets;
+        std::size_t number_elements;
+        reduction::Kernel reduction_kernel;
+
+        // Reduces `number_elements` values from `inputs` into `inouts`
+        template<typename T>
+        void apply_reduce_op(T* inouts, T const* inputs, std::size_t number_elements)
+        {
+          reduction_kernel(inouts, inputs, number_elements);
+        }
+    };
+
+    template<typename T, ReduceScatterAlgorithm Algorithm>
+    class ReduceScatterLowLevel : public ReduceScatterCommon
+    { };
+  }
+}
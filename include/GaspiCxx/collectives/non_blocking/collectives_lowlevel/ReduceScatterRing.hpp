@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ReduceScatterRing.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/ReduceScatterCommon.hpp>
+#include <GaspiCxx/group/Utilities.hpp>
+#include <GaspiCxx/singlesided/write/SourceBuffer.hpp>
+#include <GaspiCxx/singlesided/write/TargetBuffer.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // Reduce stage of the ring Allreduce: in each of the P-1 steps, a rank
+    // sends one block to its right neighbor and reduces the block received
+    // from its left neighbor into its own data, which it forwards in the
+    // next step. After the last step, each rank holds its fully reduced block.
+    template<typename T>
+    class ReduceScatterLowLevel<T, ReduceScatterAlgorithm::RING> : public ReduceScatterCommon
+    {
+      using SourceBuffer = gaspi::singlesided::write::SourceBuffer;
+      using TargetBuffer = gaspi::singlesided::write::TargetBuffer;
+      using ConnectHandle = gaspi::singlesided::Endpoint::ConnectHandle;
+
+      public:
+        using ReduceScatterCommon::ReduceScatterCommon;
+
+        ReduceScatterLowLevel(gaspi::group::Group const& group,
+                              std::vector<std::size_t> const& counts,
+                              ReductionKernel<T> reduction_kernel);
+
+      private:
+        std::size_t number_ranks;
+        gaspi::group::Rank rank;
+        std::size_t number_steps;
+
+        // inputs of all blocks, stored contiguously
+        std::unique_ptr<SourceBuffer> data_buffer;
+        // one buffer per step
+        std::vector<std::unique_ptr<SourceBuffer>> source_buffers;
+        std::vector<std::unique_ptr<TargetBuffer>> target_buffers;
+        std::vector<ConnectHandle> handles;
+        std::vector<T> data_for_1rank_case;
+
+        std::size_t current_step;
+
+        void waitForSetupImpl() override;
+        void copyInImpl(void const*) override;
+        void copyOutImpl(void*) override;
+
+        void startImpl() override;
+        bool triggerProgressImpl() override;
+
+        bool is_trivial() const;
+        std::size_t get_send_block(std::size_t step) const;
+        std::size_t get_receive_block(std::size_t step) const;
+        T* get_block_begin(std::size_t block) const;
+        void start_block_transfer(std::size_t step);
+    };
+
+    template<typename T>
+    ReduceScatterLowLevel<T, ReduceScatterAlgorithm::RING>::ReduceScatterLowLevel(
+                      gaspi::group::Group const& group,
+                      std::vector<std::size_t> const& counts,
+                      ReductionKernel<T> reduction_kernel)
+    : ReduceScatterCommon(group, counts, reduction_kernel.get_untyped_kernel()),
+      number_ranks(group.size()),
+      rank(group.rank()),
+      number_steps(number_ranks - 1),
+      data_buffer(),
+      source_buffers(),
+      target_buffers(),
+      handles(),
+      data_for_1rank_case(),
+      current_step(0)
+    {
+      if (is_trivial())
+      {
+        data_for_1rank_case.resize(number_elements);
+        return;
+      }
+
+      auto const size_bytes = sizeof(T) * number_elements;
+      data_buffer = std::make_unique<SourceBuffer>(
+                      gaspi::getRuntime().getFreeSegment(size_bytes), size_bytes);
+
+      gaspi::group::Rank const left_neighbor(group::decrementRankOnRing(rank, number_ranks));
+      gaspi::group::Rank const right_neighbor(group::incrementRankOnRing(rank, number_ranks));
+      for (auto step = 0UL; step < number_steps; ++step)
+      {
+        source_buffers.push_back(std::make_unique<SourceBuffer>(*data_buffer));
+        target_buffers.push_back(std::make_unique<TargetBuffer>(
+                                   sizeof(T) * counts[get_receive_block(step)]));
+
+        SourceBuffer::Tag const source_tag = step;
+        TargetBuffer::Tag const target_tag = step;
+        handles.push_back(source_buffers.back()->connectToRemoteTarget(
+                            group, right_neighbor, source_tag));
+        handles.push_back(target_buffers.back()->connectToRemoteSource(
+                            group, left_neighbor, target_tag));
+      }
+    }
+
+    template<typename T>
+    void ReduceScatterLowLevel<T, ReduceScatterAlgorithm::RING>::waitForSetupImpl()
+    {
+      for (auto& handle : handles)
+      {
+        handle.waitForCompletion();
+      }
+    }
+
+    template<typename T>
+    void ReduceScatterLowLevel<T, ReduceScatterAlgorithm::RING>::startImpl()
+    {
+      if (is_trivial()) { return; }
+
+      current_step = 0;
+      start_block_transfer(current_step);
+    }
+
+    template<typename T>
+    bool ReduceScatterLowLevel<T, ReduceScatterAlgorithm::RING>::triggerProgressImpl()
+    {
+      if (is_trivial()) { return true; }
+
+      // the left neighbor may overwrite the target buffers in the next run
+      // only after the right neighbor has received the last block
+      if (current_step == number_steps)
+      {
+        return source_buffers[number_steps - 1]->checkForTransferAck();
+      }
+
+      auto made_progress = target_buffers[current_step]->checkForCompletion();
+      if (!made_progress) { return false; }
+
+      auto const block = get_receive_block(current_step);
+      apply_reduce_op<T>(get_block_begin(block),
+                         static_cast<T const*>(target_buffers[current_step]->address()),
+                         counts[block]);
+
+      current_step++;
+      if (current_step == number_steps)
+      {
+        target_buffers[current_step - 1]->ackTransfer();
+      }
+      else
+      {
+        start_block_transfer(current_step);
+      }
+      return false;
+    }
+
+    template<typename T>
+    void ReduceScatterLowLevel<T, ReduceScatterAlgorithm::RING>::copyInImpl(void const* inputs)
+    {
+      auto const begin = static_cast<T const*>(inputs);
+      auto const data = is_trivial() ? data_for_1rank_case.data()
+                                     : static_cast<T*>(data_buffer->address());
+      std::copy(begin, begin + number_elements, data);
+    }
+
+    template<typename T>
+    void ReduceScatterLowLevel<T, ReduceScatterAlgorithm::RING>::copyOutImpl(void* outputs)
+    {
+      auto const block = rank.get();
+      auto const begin = is_trivial() ? data_for_1rank_case.data() + offsets[block]
+                                      : get_block_begin(block);
+      std::copy(begin, begin + counts[block], static_cast<T*>(outputs));
+    }
+
+    template<typename T>
+    bool ReduceScatterLowLevel<T, ReduceScatterAlgorithm::RING>::is_trivial() const
+    {
+      return number_ranks == 1 || number_elements == 0;
+    }
+
+    // In step `s`, rank `r` sends block `r-1-s` and receives block `r-2-s`,
+    // such that it receives its own block `r` in the last step
+    template<typename T>
+    std::size_t ReduceScatterLowLevel<T, ReduceScatterAlgorithm::RING>::get_send_block(
+                  std::size_t step) const
+    {
+      return (rank.get() + 2 * number_ranks - 1 - step) % number_ranks;
+    }
+
+    template<typename T>
+    std::size_t ReduceScatterLowLevel<T, ReduceScatterAlgorithm::RING>::get_receive_block(
+                  std::size_t step) const
+    {
+      return get_send_block(step + 1);
+    }
+
+    template<typename T>
+    T* ReduceScatterLowLevel<T, ReduceScatterAlgorithm::RING>::get_block_begin(
+                  std::size_t block) const
+    {
+      return static_cast<T*>(data_buffer->address()) + offsets[block];
+    }
+
+    template<typename T>
+    void ReduceScatterLowLevel<T, ReduceScatterAlgorithm::RING>::start_block_transfer(
+                  std::size_t step)
+    {
+      auto const block = get_send_block(step);
+      source_buffers[step]->initTransferPart(sizeof(T) * counts[block],
+                                             sizeof(T) * offsets[block]);
+    }
+  }
+}
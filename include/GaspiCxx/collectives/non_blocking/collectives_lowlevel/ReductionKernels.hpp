@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ReductionKernels.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/HalfPrecision.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // Element type for MINLOC/MAXLOC reductions, which determine
+    // the extremal value together with the location it stems from
+    // (e.g., the rank that contributed it)
+    template<typename T, typename Location = std::int32_t>
+    struct ValueLocation
+    {
+      T value;
+      Location location;
+
+      bool operator==(ValueLocation const& other) const
+      {
+        return value == other.value && location == other.location;
+      }
+    };
+
+    template<typename T>
+    struct is_value_location : std::false_type { };
+
+    template<typename T, typename Location>
+    struct is_value_location<ValueLocation<T, Location>> : std::true_type { };
+
+    namespace reduction
+    {
+      // Width (in bytes) of the widest SIMD registers enabled at compile time
+#if defined(__AVX512F__)
+      static constexpr std::size_t simd_width_bytes = 64;
+#elif defined(__AVX__)
+      static constexpr std::size_t simd_width_bytes = 32;
+#elif defined(__SSE2__) || defined(__ARM_NEON)
+      static constexpr std::size_t simd_width_bytes = 16;
+#else
+      static constexpr std::size_t simd_width_bytes = 0;
+#endif
+
+      template<typename T>
+      static constexpr bool is_simd_type = std::is_arithmetic_v<T> &&
+                                           !std::is_same_v<T, bool>;
+
+      // Type in which reductions on elements of type `T` are computed
+      template<typename T>
+      struct accumulation_type { using type = T; };
+
+      template<>
+      struct accumulation_type<float16> { using type = float; };
+
+      template<>
+      struct accumulation_type<bfloat16> { using type = float; };
+
+      template<typename T>
+      using accumulation_type_t = typename accumulation_type<T>::type;
+
+      // Element-wise operations
+      //
+      // Each operation defines for which element types it is `applicable`,
+      // and for which of them `apply` can also be invoked on
+      // (GCC/Clang) SIMD vectors of the same element type (`vectorizable`).
+      struct Sum
+      {
+        template<typename T>
+        static constexpr bool applicable = std::is_arithmetic_v<T>;
+        template<typename T>
+        static constexpr bool vectorizable = is_simd_type<T>;
+
+        template<typename V>
+        static V apply(V const& a, V const& b) { return a + b; }
+      };
+
+      struct Prod
+      {
+        template<typename T>
+        static constexpr bool applicable = std::is_arithmetic_v<T>;
+        template<typename T>
+        static constexpr bool vectorizable = is_simd_type<T>;
+
+        template<typename V>
+        static V apply(V const& a, V const& b) { return a * b; }
+      };
+
+      struct Min
+      {
+        template<typename T>
+        static constexpr bool applicable = std::is_arithmetic_v<T>;
+        template<typename T>
+        static constexpr bool vectorizable = is_simd_type<T>;
+
+        template<typename V>
+        static V apply(V const& a, V const& b) { return b < a ? b : a; }
+      };
+
+      struct Max
+      {
+        template<typename T>
+        static constexpr bool applicable = std::is_arithmetic_v<T>;
+        template<typename T>
+        static constexpr bool vectorizable = is_simd_type<T>;
+
+        template<typename V>
+        static V apply(V const& a, V const& b) { return a < b ? b : a; }
+      };
+
+      struct BitwiseAnd
+      {
+        template<typename T>
+        static constexpr bool applicable = std::is_integral_v<T>;
+        template<typename T>
+        static constexpr bool vectorizable = is_simd_type<T>;
+
+        template<typename V>
+        static V apply(V const& a, V const& b) { return a & b; }
+      };
+
+      struct BitwiseOr
+      {
+        template<typename T>
+        static constexpr bool applicable = std::is_integral_v<T>;
+        template<typename T>
+        static constexpr bool vectorizable = is_simd_type<T>;
+
+        template<typename V>
+        static V apply(V const& a, V const& b) { return a | b; }
+      };
+
+      struct BitwiseXor
+      {
+        template<typename T>
+        static constexpr bool applicable = std::is_integral_v<T>;
+        template<typename T>
+        static constexpr bool vectorizable = is_simd_type<T>;
+
+        template<typename V>
+        static V apply(V const& a, V const& b) { return a ^ b; }
+      };
+
+      // Logical operations yield 1 (true) or 0 (false)
+      struct LogicalAnd
+      {
+        template<typename T>
+        static constexpr bool applicable = std::is_arithmetic_v<T>;
+        template<typename T>
+        static constexpr bool vectorizable = false;
+
+        template<typename V>
+        static V apply(V const& a, V const& b) { return static_cast<V>(a != V(0) && b != V(0)); }
+      };
+
+      struct LogicalOr
+      {
+        template<typename T>
+        static constexpr bool applicable = std::is_arithmetic_v<T>;
+        template<typename T>
+        static constexpr bool vectorizable = false;
+
+        template<typename V>
+        static V apply(V const& a, V const& b) { return static_cast<V>(a != V(0) || b != V(0)); }
+      };
+
+      // Ties are resolved towards the smaller location, as in MPI
+      struct MinLocation
+      {
+        template<typename T>
+        static constexpr bool applicable = is_value_location<T>::value;
+        template<typename T>
+        static constexpr bool vectorizable = false;
+
+        template<typename V>
+        static V apply(V const& a, V const& b)
+        {
+          if (b.value < a.value || (b.value == a.value && b.location < a.location))
+          {
+            return b;
+          }
+          return a;
+        }
+      };
+
+      struct MaxLocation
+      {
+        template<typename T>
+        static constexpr bool applicable = is_value_location<T>::value;
+        template<typename T>
+        static constexpr bool vectorizable = false;
+
+        template<typename V>
+        static V apply(V const& a, V const& b)
+        {
+          if (a.value < b.value || (b.value == a.value && b.location < a.location))
+          {
+            return b;
+          }
+          return a;
+        }
+      };
+
+#if defined(__GNUC__)
+      template<typename T, std::size_t width_bytes>
+      struct SimdVector
+      {
+        using Type [[gnu::vector_size(width_bytes)]] = T;
+      };
+#endif
+
+      template<typename T, typename Op>
+      void reduce(T* inouts, T const* inputs, std::size_t number_elements);
+
+      // Converts blocks of elements to the accumulation type, such that
+      // they can be reduced with the (vectorized) kernel for that type
+      template<typename T, typename Op>
+      void reduce_widened(T* inouts, T const* inputs, std::size_t number_elements)
+      {
+        using AccumulationType = accumulation_type_t<T>;
+        constexpr std::size_t block_size = 256;
+        AccumulationType inouts_block[block_size];
+        AccumulationType inputs_block[block_size];
+
+        for (auto begin = 0UL; begin < number_elements; begin += block_size)
+        {
+          auto const block_elements = std::min(block_size, number_elements - begin);
+          for (auto i = 0UL; i < block_elements; ++i)
+          {
+            inouts_block[i] = static_cast<AccumulationType>(inouts[begin + i]);
+            inputs_block[i] = static_cast<AccumulationType>(inputs[begin + i]);
+          }
+          reduce<AccumulationType, Op>(inouts_block, inputs_block, block_elements);
+          for (auto i = 0UL; i < block_elements; ++i)
+          {
+            inouts[begin + i] = T(inouts_block[i]);
+          }
+        }
+      }
+
+      // Reduces `number_elements` values from `inputs` into `inouts`,
+      // using explicit SIMD vectors for the bulk of the elements, if
+      // supported for `T` and `Op`, and a scalar loop for the remainder.
+      // Elements stored in reduced precision are reduced in their
+      // accumulation type.
+      template<typename T, typename Op>
+      void reduce(T* inouts, T const* inputs, std::size_t number_elements)
+      {
+        if constexpr (!std::is_same_v<T, accumulation_type_t<T>>)
+        {
+          reduce_widened<T, Op>(inouts, inputs, number_elements);
+        }
+        else
+        {
+          auto i = 0UL;
+#if defined(__GNUC__)
+          if constexpr (simd_width_bytes > 0 && Op::template vectorizable<T>)
+          {
+            using Vector = typename SimdVector<T, simd_width_bytes>::Type;
+            constexpr auto lanes = sizeof(Vector) / sizeof(T);
+            auto const number_elements_simd = number_elements - number_elements % lanes;
+
+            for (; i < number_elements_simd; i += lanes)
+            {
+              Vector inout;
+              Vector input;
+              std::memcpy(&inout, inouts + i, sizeof(Vector));
+              std::memcpy(&input, inputs + i, sizeof(Vector));
+              inout = Op::apply(inout, input);
+              std::memcpy(inouts + i, &inout, sizeof(Vector));
+            }
+          }
+#endif
+          for (; i < number_elements; ++i)
+          {
+            inouts[i] = Op::apply(inouts[i], inputs[i]);
+          }
+        }
+      }
+
+      // Type-erased kernel, such that a kernel can be selected once
+      // and stored independently of the element type
+      using Kernel = std::function<void(void*, void const*, std::size_t)>;
+
+      template<typename T, typename Op>
+      void reduce_untyped(void* inouts, void const* inputs, std::size_t number_elements)
+      {
+        reduce<T, Op>(static_cast<T*>(inouts), static_cast<T const*>(inputs),
+                      number_elements);
+      }
+
+      // Returns a null kernel if `Op` is not applicable to `T`
+      template<typename T, typename Op>
+      Kernel get_kernel()
+      {
+        if constexpr (Op::template applicable<accumulation_type_t<T>>)
+        {
+          return &reduce_untyped<T, Op>;
+        }
+        else
+        {
+          return nullptr;
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * RootedTree.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/group/Group.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // Position of a rank in a tree spanning the group, in terms of ranks
+    // relative to the root (i.e., the root is at position 0).
+    // The subtree of the rank at position `v` spans the positions
+    // [v, subtree_end), and its children are sorted in increasing order,
+    // such that the subtree of each child ends where the next one begins.
+    struct RootedTreeNode
+    {
+      std::size_t parent; // not used on the root
+      std::size_t subtree_end;
+      std::vector<std::size_t> children;
+    };
+
+    std::size_t get_relative_rank(gaspi::group::Group const& group,
+                                  gaspi::group::Rank const& root);
+    gaspi::group::Rank get_group_rank(gaspi::group::Group const& group,
+                                      gaspi::group::Rank const& root,
+                                      std::size_t relative_rank);
+
+    // Binomial tree of depth log P, in which the rank at position `v` has
+    // the children `v + 2^i` for all `2^i` below the lowest set bit of `v`
+    RootedTreeNode get_binomial_tree_node(std::size_t relative_rank,
+                                          std::size_t number_ranks);
+
+    // Tree of depth one, in which the root is the parent of all other ranks
+    RootedTreeNode get_flat_tree_node(std::size_t relative_rank,
+                                      std::size_t number_ranks);
+  }
+}
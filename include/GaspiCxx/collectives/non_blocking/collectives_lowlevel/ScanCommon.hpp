@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ScanCommon.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/CollectiveLowLevel.hpp>
+#include <GaspiCxx/group/Group.hpp>
+
+#include <array>
+#include <string>
+#include <unordered_map>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    class ScanInfo
+    {
+      public:
+        enum class Algorithm
+        {
+          RECURSIVE_DOUBLING,
+        };
+        static inline std::unordered_map<Algorithm, std::string> names
+                      { {Algorithm::RECURSIVE_DOUBLING, "recursivedoubling" } };
+        static inline constexpr std::array<Algorithm, 1> implemented
+                      { Algorithm::RECURSIVE_DOUBLING };
+    };
+    using ScanAlgorithm = ScanInfo::Algorithm;
+
+    // INCLUSIVE: rank `i` obtains the reduction of the inputs of ranks 0..i
+    // EXCLUSIVE: rank `i` obtains the reduction of the inputs of ranks 0..i-1,
+    //            i.e., rank 0 has no outputs
+    enum class ScanType
+    {
+      INCLUSIVE,
+      EXCLUSIVE,
+    };
+
+    class ScanCommon : public CollectiveLowLevel
+    {
+      public:
+        ScanCommon(gaspi::group::Group const& group,
+                   std::size_t number_elements,
+                   ScanType scan_type,
+                   reduction::Kernel reduction_kernel);
+        virtual ~ScanCommon() = default;
+
+        // `number_elements`, except for rank 0 in an exclusive scan
+        std::size_t getOutputCount() override;
+
+      protected:
+        gaspi::group::Group group;
+        std::size_t number_elements;
+        ScanType scan_type;
+        reduction::Kernel reduction_kernel;
+
+        // Reduces `number_elements` values from `inputs` into `inouts`
+        template<typename T>
+        void apply_reduce_op(T* inouts, T const* inputs, std::size_t number_elements)
+        {
+          reduction_kernel(inouts, inputs, number_elements);
+        }
+    };
+
+    template<typename T, ScanAlgorithm Algorithm>
+    class ScanLowLevel : public ScanCommon
+    { };
+  }
+}
@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ScanRecursiveDoubling.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/ScanCommon.hpp>
+#include <GaspiCxx/singlesided/write/SourceBuffer.hpp>
+#include <GaspiCxx/singlesided/write/TargetBuffer.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    /*
+     * RECURSIVE (DISTANCE) DOUBLING SCAN
+     * ==================================
+     *
+     *   In iteration `k` (of ceil(log_2 p)), each rank exchanges its partial
+     *   reduction with the partner `rank XOR 2^k` (if it exists), and reduces
+     *   the received vector into its partial reduction. Received vectors
+     *   from lower ranks are also reduced into the result.
+     *
+     *   The partial reduction of a rank thus covers the ranks that share all
+     *   bits above `k`, and its result all lower ranks among them, i.e.,
+     *   ranks 0..rank (inclusive scan) or 0..rank-1 (exclusive scan) at the end.
+     *
+     *   Example (3 ranks, inclusive):
+     *       rank       0      1      2
+     *       input     [0]    [1]    [2]
+     *     Iteration 0 (partners 0-1):
+     *       partial  [0-1]  [0-1]   [2]
+     *       result    [0]   [0-1]   [2]
+     *     Iteration 1 (partners 0-2):
+     *       partial  [0-2]  [0-1]  [0-2]
+     *       result    [0]   [0-1]  [0-2]
+     *
+     *   Each iteration sends from its own buffer, such that the partial
+     *   reduction can be updated as soon as the partner's vector arrives.
+     */
+    template<typename T>
+    class ScanLowLevel<T, ScanAlgorithm::RECURSIVE_DOUBLING> : public ScanCommon
+    {
+      using SourceBuffer = gaspi::singlesided::write::SourceBuffer;
+      using TargetBuffer = gaspi::singlesided::write::TargetBuffer;
+      using ConnectHandle = gaspi::singlesided::Endpoint::ConnectHandle;
+
+      public:
+        ScanLowLevel(gaspi::group::Group const& group,
+                     std::size_t number_elements,
+                     ScanType scan_type,
+                     ReductionKernel<T> reduction_kernel);
+
+      private:
+        std::size_t number_ranks;
+        gaspi::group::Rank rank;
+
+        std::vector<T> partial_result;
+        std::vector<T> result;
+        bool has_result;
+
+        // partners and buffers of the iterations in which a partner exists
+        std::vector<gaspi::group::Rank> partners;
+        std::vector<std::unique_ptr<SourceBuffer>> source_buffers;
+        std::vector<std::unique_ptr<TargetBuffer>> target_buffers;
+        std::vector<ConnectHandle> handles;
+
+        std::size_t iteration;
+        std::vector<bool> is_acknowledged;
+        std::size_t number_acknowledged;
+
+        void waitForSetupImpl() override;
+        void copyInImpl(void const*) override;
+        void copyOutImpl(void*) override;
+
+        void startImpl() override;
+        bool triggerProgressImpl() override;
+
+        bool is_trivial() const;
+        bool is_last_iteration() const;
+        void send_partial_result();
+        void reduce_received_data();
+    };
+
+    template<typename T>
+    ScanLowLevel<T, ScanAlgorithm::RECURSIVE_DOUBLING>::ScanLowLevel(
+                      gaspi::group::Group const& group,
+                      std::size_t number_elements,
+                      ScanType scan_type,
+                      ReductionKernel<T> reduction_kernel)
+    : ScanCommon(group, number_elements, scan_type, reduction_kernel.get_untyped_kernel()),
+      number_ranks(group.size()),
+      rank(group.rank()),
+      partial_result(number_elements),
+      result(number_elements),
+      has_result(false),
+      partners(),
+      source_buffers(),
+      target_buffers(),
+      handles(),
+      iteration(0),
+      is_acknowledged(),
+      number_acknowledged(0)
+    {
+      if (is_trivial()) { return; }
+
+      auto const size_bytes = sizeof(T) * number_elements;
+      auto step = 0UL;
+      for (auto distance = 1UL; distance < number_ranks; distance <<= 1, ++step)
+      {
+        auto const partner = rank.get() ^ distance;
+        if (partner >= number_ranks) { continue; }
+
+        partners.push_back(gaspi::group::Rank(partner));
+        source_buffers.push_back(std::make_unique<SourceBuffer>(size_bytes));
+        target_buffers.push_back(std::make_unique<TargetBuffer>(size_bytes));
+
+        // both partners skip the same iterations, tag by the iteration number
+        auto const tag = SourceBuffer::Tag(step);
+        handles.push_back(source_buffers.back()->connectToRemoteTarget(group, partners.back(), tag));
+        handles.push_back(target_buffers.back()->connectToRemoteSource(group, partners.back(), tag));
+      }
+      is_acknowledged.resize(source_buffers.size(), false);
+      iteration = source_buffers.size();
+    }
+
+    template<typename T>
+    void ScanLowLevel<T, ScanAlgorithm::RECURSIVE_DOUBLING>::waitForSetupImpl()
+    {
+      for (auto& handle : handles)
+      {
+        handle.waitForCompletion();
+      }
+    }
+
+    template<typename T>
+    void ScanLowLevel<T, ScanAlgorithm::RECURSIVE_DOUBLING>::startImpl()
+    {
+      std::fill(is_acknowledged.begin(), is_acknowledged.end(), false);
+      number_acknowledged = 0;
+      has_result = (scan_type == ScanType::INCLUSIVE);
+      iteration = 0;
+      if (!is_trivial() && !is_last_iteration())
+      {
+        send_partial_result();
+      }
+    }
+
+    template<typename T>
+    bool ScanLowLevel<T, ScanAlgorithm::RECURSIVE_DOUBLING>::triggerProgressImpl()
+    {
+      if (is_trivial()) { return true; }
+
+      while (!is_last_iteration())
+      {
+        if (!target_buffers[iteration]->checkForCompletion()) { return false; }
+        reduce_received_data();
+        target_buffers[iteration]->ackTransfer();
+
+        iteration++;
+        if (!is_last_iteration())
+        {
+          send_partial_result();
+        }
+      }
+
+      // the source buffers are reused in the next run
+      for (auto i = 0UL; i < source_buffers.size(); ++i)
+      {
+        if (is_acknowledged[i] || !source_buffers[i]->checkForTransferAck()) { continue; }
+
+        is_acknowledged[i] = true;
+        number_acknowledged++;
+      }
+      return number_acknowledged == source_buffers.size();
+    }
+
+    template<typename T>
+    void ScanLowLevel<T, ScanAlgorithm::RECURSIVE_DOUBLING>::copyInImpl(void const* inputs)
+    {
+      if (is_trivial()) { return; }
+
+      auto const begin = static_cast<T const*>(inputs);
+      std::copy(begin, begin + number_elements, partial_result.begin());
+      if (scan_type == ScanType::INCLUSIVE)
+      {
+        std::copy(begin, begin + number_elements, result.begin());
+      }
+    }
+
+    template<typename T>
+    void ScanLowLevel<T, ScanAlgorithm::RECURSIVE_DOUBLING>::copyOutImpl(void* outputs)
+    {
+      if (is_trivial() || getOutputCount() == 0) { return; }
+
+      std::copy(result.begin(), result.end(), static_cast<T*>(outputs));
+    }
+
+    template<typename T>
+    bool ScanLowLevel<T, ScanAlgorithm::RECURSIVE_DOUBLING>::is_trivial() const
+    {
+      return number_elements == 0;
+    }
+
+    template<typename T>
+    bool ScanLowLevel<T, ScanAlgorithm::RECURSIVE_DOUBLING>::is_last_iteration() const
+    {
+      return iteration >= source_buffers.size();
+    }
+
+    template<typename T>
+    void ScanLowLevel<T, ScanAlgorithm::RECURSIVE_DOUBLING>::send_partial_result()
+    {
+      auto& source_buffer = source_buffers[iteration];
+      std::copy(partial_result.begin(), partial_result.end(),
+                static_cast<T*>(source_buffer->address()));
+      source_buffer->initTransfer();
+    }
+
+    template<typename T>
+    void ScanLowLevel<T, ScanAlgorithm::RECURSIVE_DOUBLING>::reduce_received_data()
+    {
+      auto const received = static_cast<T const*>(target_buffers[iteration]->address());
+      apply_reduce_op(partial_result.data(), received, number_elements);
+
+      if (partners[iteration] > rank) { return; }
+      if (has_result)
+      {
+        apply_reduce_op(result.data(), received, number_elements);
+      }
+      else
+      {
+        std::copy(received, received + number_elements, result.begin());
+        has_result = true;
+      }
+    }
+  }
+}
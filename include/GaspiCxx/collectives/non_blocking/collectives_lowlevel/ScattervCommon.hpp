@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ScattervCommon.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/CollectiveLowLevel.hpp>
+#include <GaspiCxx/group/Group.hpp>
+
+#include <array>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    class ScattervInfo
+    {
+      public:
+        enum class Algorithm
+        {
+          BINOMIAL_TREE,
+          DIRECT,
+        };
+        static inline std::unordered_map<Algorithm, std::string> names
+                      { {Algorithm::BINOMIAL_TREE, "binomialtree" },
+                        {Algorithm::DIRECT, "direct" } };
+        static inline constexpr std::array<Algorithm, 2> implemented
+                      { Algorithm::BINOMIAL_TREE, Algorithm::DIRECT };
+    };
+    using ScattervAlgorithm = ScattervInfo::Algorithm;
+
+    // Distributes consecutive parts of the data of the `root`, such that
+    // each rank `i` obtains `counts[i]` elements.
+    // Only the root provides inputs, i.e., non-root ranks copy in `NO_DATA`.
+    class ScattervCommon : public CollectiveLowLevel
+    {
+      public:
+        ScattervCommon(gaspi::group::Group const& group,
+                       std::vector<std::size_t> const& counts,
+                       gaspi::group::Rank const& root);
+        virtual ~ScattervCommon() = default;
+
+        // number of elements received by the calling rank
+        std::size_t getOutputCount() override;
+
+      protected:
+        gaspi::group::Group group;
+        std::vector<std::size_t> counts;
+        std::vector<std::size_t> offsets;
+        std::size_t number_elements;
+        gaspi::group::Rank root;
+    };
+
+    template<typename T, ScattervAlgorithm Algorithm>
+    class ScattervLowLevel : public ScattervCommon
+    { };
+  }
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ScattervDirect.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/ScattervCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/ScattervTree.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/RootedTree.hpp>
+
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // The root writes the part of each rank directly from its buffer
+    // (P-1 writes at different offsets), i.e., every byte is transferred
+    // only once. Suited for large messages.
+    template<typename T>
+    class ScattervLowLevel<T, ScattervAlgorithm::DIRECT> : public ScattervTree<T>
+    {
+      public:
+        ScattervLowLevel(gaspi::group::Group const& group,
+                        std::vector<std::size_t> const& counts,
+                        gaspi::group::Rank const& root);
+    };
+
+    template<typename T>
+    ScattervLowLevel<T, ScattervAlgorithm::DIRECT>::ScattervLowLevel(
+                      gaspi::group::Group const& group,
+                      std::vector<std::size_t> const& counts,
+                      gaspi::group::Rank const& root)
+    : ScattervTree<T>(group, counts, root,
+                     get_flat_tree_node(get_relative_rank(group, root), group.size()))
+    { }
+  }
+}
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ScattervTree.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/RootedTree.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/ScattervCommon.hpp>
+#include <GaspiCxx/singlesided/write/SourceBuffer.hpp>
+#include <GaspiCxx/singlesided/write/TargetBuffer.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // Scatters along a tree given by the algorithm: each rank receives the
+    // data of its whole subtree (ordered by relative position) from its
+    // parent, and forwards the parts of its children directly from
+    // the received buffer (i.e., using one source buffer per child on
+    // the same memory, written with different offsets).
+    //
+    // A rank acknowledges the data of its parent only once it does not
+    // need it any more, i.e., after copying out its own part.
+    template<typename T>
+    class ScattervTree : public ScattervCommon
+    {
+      using SourceBuffer = gaspi::singlesided::write::SourceBuffer;
+      using TargetBuffer = gaspi::singlesided::write::TargetBuffer;
+      using Endpoint = gaspi::singlesided::Endpoint;
+      using ConnectHandle = Endpoint::ConnectHandle;
+
+      protected:
+        ScattervTree(gaspi::group::Group const& group,
+                     std::vector<std::size_t> const& counts,
+                     gaspi::group::Rank const& root,
+                     RootedTreeNode const& node);
+
+      private:
+        std::size_t number_ranks;
+        gaspi::group::Rank rank;
+        // offsets of the data of each relative position within the scattered data
+        std::vector<std::size_t> relative_offsets;
+
+        // data of the subtree, received from the parent (or copied in on the root)
+        std::unique_ptr<SourceBuffer> root_buffer;
+        std::unique_ptr<TargetBuffer> target_buffer;
+        // one buffer per child, on the memory of the subtree data
+        std::vector<std::unique_ptr<SourceBuffer>> source_buffers;
+        // offsets and sizes (in bytes) of the subtrees of the children
+        std::vector<std::size_t> child_offsets;
+        std::vector<std::size_t> child_sizes;
+        std::vector<ConnectHandle> handles;
+
+        bool is_received;
+        std::vector<bool> is_child_acknowledged;
+        std::size_t number_children_acknowledged;
+
+        void waitForSetupImpl() override;
+        void copyInImpl(void const*) override;
+        void copyOutImpl(void*) override;
+
+        void startImpl() override;
+        bool triggerProgressImpl() override;
+
+        bool is_trivial() const;
+        T* get_subtree_data() const;
+        gaspi::group::Rank to_group_rank(std::size_t relative_rank) const;
+        void send_to_children();
+    };
+
+    template<typename T>
+    ScattervTree<T>::ScattervTree(gaspi::group::Group const& group,
+                                  std::vector<std::size_t> const& counts,
+                                  gaspi::group::Rank const& root,
+                                  RootedTreeNode const& node)
+    : ScattervCommon(group, counts, root),
+      number_ranks(group.size()),
+      rank(group.rank()),
+      relative_offsets(number_ranks + 1, 0),
+      root_buffer(),
+      target_buffer(),
+      source_buffers(),
+      child_offsets(),
+      child_sizes(),
+      handles(),
+      is_received(false),
+      is_child_acknowledged(node.children.size(), false),
+      number_children_acknowledged(0)
+    {
+      for (auto i = 0UL; i < number_ranks; ++i)
+      {
+        relative_offsets[i + 1] = relative_offsets[i] + counts[to_group_rank(i).get()];
+      }
+      if (is_trivial()) { return; }
+
+      auto const relative_rank = get_relative_rank(group, root);
+      auto const subtree_begin = relative_offsets[relative_rank];
+      auto const size_bytes = sizeof(T) * (relative_offsets[node.subtree_end] - subtree_begin);
+      auto& segment = gaspi::getRuntime().getFreeSegment(size_bytes);
+      if (rank == root)
+      {
+        root_buffer = std::make_unique<SourceBuffer>(segment, size_bytes);
+      }
+      else
+      {
+        target_buffer = std::make_unique<TargetBuffer>(segment, size_bytes);
+        TargetBuffer::Tag const tag = 0;
+        handles.push_back(target_buffer->connectToRemoteSource(
+                            group, to_group_rank(node.parent), tag));
+      }
+
+      Endpoint const& subtree_buffer = rank == root ? static_cast<Endpoint const&>(*root_buffer)
+                                                    : *target_buffer;
+      for (auto i = 0UL; i < node.children.size(); ++i)
+      {
+        auto const child = node.children[i];
+        auto const child_end = i + 1 < node.children.size() ? node.children[i + 1]
+                                                            : node.subtree_end;
+        child_offsets.push_back(sizeof(T) * (relative_offsets[child] - subtree_begin));
+        child_sizes.push_back(sizeof(T) * (relative_offsets[child_end] - relative_offsets[child]));
+
+        source_buffers.push_back(std::make_unique<SourceBuffer>(subtree_buffer));
+        SourceBuffer::Tag const tag = 0;
+        handles.push_back(source_buffers.back()->connectToRemoteTarget(
+                            group, to_group_rank(child), tag));
+      }
+    }
+
+    template<typename T>
+    void ScattervTree<T>::waitForSetupImpl()
+    {
+      for (auto& handle : handles)
+      {
+        handle.waitForCompletion();
+      }
+    }
+
+    template<typename T>
+    void ScattervTree<T>::startImpl()
+    {
+      std::fill(is_child_acknowledged.begin(), is_child_acknowledged.end(), false);
+      number_children_acknowledged = 0;
+      is_received = (rank == root);
+
+      if (rank == root && !is_trivial())
+      {
+        send_to_children();
+      }
+    }
+
+    template<typename T>
+    bool ScattervTree<T>::triggerProgressImpl()
+    {
+      if (is_trivial()) { return true; }
+
+      if (!is_received)
+      {
+        if (!target_buffer->checkForCompletion()) { return false; }
+        is_received = true;
+        send_to_children();
+      }
+
+      for (auto i = 0UL; i < source_buffers.size(); ++i)
+      {
+        if (is_child_acknowledged[i] || !source_buffers[i]->checkForTransferAck()) { continue; }
+
+        is_child_acknowledged[i] = true;
+        number_children_acknowledged++;
+      }
+      return number_children_acknowledged == source_buffers.size();
+    }
+
+    template<typename T>
+    void ScattervTree<T>::copyInImpl(void const* inputs)
+    {
+      if (rank != root || is_trivial()) { return; }
+
+      // reorder from ranks to relative positions
+      auto const begin = static_cast<T const*>(inputs);
+      auto const data = get_subtree_data();
+      for (auto i = 0UL; i < number_ranks; ++i)
+      {
+        auto const group_rank = to_group_rank(i).get();
+        std::copy(begin + offsets[group_rank], begin + offsets[group_rank] + counts[group_rank],
+                  data + relative_offsets[i]);
+      }
+    }
+
+    template<typename T>
+    void ScattervTree<T>::copyOutImpl(void* outputs)
+    {
+      if (is_trivial()) { return; }
+
+      // the own part is at the beginning of the subtree
+      auto const data = get_subtree_data();
+      std::copy(data, data + counts[rank.get()], static_cast<T*>(outputs));
+      if (rank != root)
+      {
+        target_buffer->ackTransfer();
+      }
+    }
+
+    template<typename T>
+    bool ScattervTree<T>::is_trivial() const
+    {
+      return number_elements == 0;
+    }
+
+    template<typename T>
+    T* ScattervTree<T>::get_subtree_data() const
+    {
+      return static_cast<T*>(rank == root ? root_buffer->address()
+                                          : target_buffer->address());
+    }
+
+    template<typename T>
+    gaspi::group::Rank ScattervTree<T>::to_group_rank(std::size_t relative_rank) const
+    {
+      return get_group_rank(group, root, relative_rank);
+    }
+
+    template<typename T>
+    void ScattervTree<T>::send_to_children()
+    {
+      for (auto i = 0UL; i < source_buffers.size(); ++i)
+      {
+        source_buffers[i]->initTransferPart(child_sizes[i], child_offsets[i]);
+      }
+    }
+  }
+}
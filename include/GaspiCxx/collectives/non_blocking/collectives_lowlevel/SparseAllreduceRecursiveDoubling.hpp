@@ -0,0 +1,546 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * SparseAllreduceRecursiveDoubling.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/group/Group.hpp>
+#include <GaspiCxx/singlesided/write/SourceBuffer.hpp>
+#include <GaspiCxx/singlesided/write/TargetBuffer.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/CollectiveLowLevel.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/Utilities.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // Vector of `number_elements` elements, of which only those at
+    // `indices` are stored; all others are zero
+    template<typename T>
+    struct SparseVector
+    {
+      using Index = std::uint32_t;
+
+      std::vector<Index> indices;
+      std::vector<T> values;
+    };
+
+    // Runtime settings of the sparse Allreduce
+    struct SparseAllreduceSettings
+    {
+      // Fraction of non-zero entries above which vectors are sent densely
+      // (sparse and dense payloads have about the same size at 0.5
+      // for 4-byte elements)
+      static inline double density_threshold = 0.5;
+    };
+
+    /*
+     * SPARSE ALLREDUCE (RECURSIVE DOUBLING)
+     * =====================================
+     *
+     * Reduces sparse vectors of varying numbers of entries, following the
+     * schedule of `AllreduceLowLevel<T, RECURSIVE_DOUBLING>` (including the
+     * handling of extra ranks in the non-power-of-two case).
+     * In each iteration, the partners exchange their current vectors and
+     * merge the received entries into them. Vectors whose density exceeds
+     * the threshold are converted to (and sent in) dense representation.
+     *
+     * Each payload starts with a header holding the representation and
+     * number of entries, such that only the used part of a buffer is sent.
+     * The buffers are sized for the larger of both representations.
+     *
+     * Missing entries are treated as zeros, i.e., the reduction has to
+     * have zero as neutral element (e.g., SUM).
+     *
+     * Inputs (outputs) are passed to `copyIn` (`copyOut`) as pointers to
+     * `SparseVector<T>`. Input indices may be unsorted and repeated,
+     * output indices are sorted and unique.
+     */
+    template<typename T>
+    class SparseAllreduceLowLevel : public CollectiveLowLevel
+    {
+      using SourceBuffer = gaspi::singlesided::write::SourceBuffer;
+      using TargetBuffer = gaspi::singlesided::write::TargetBuffer;
+      using ConnectHandle = gaspi::singlesided::Endpoint::ConnectHandle;
+      using Index = typename SparseVector<T>::Index;
+
+      public:
+        SparseAllreduceLowLevel(gaspi::group::Group const& group,
+                                std::size_t number_elements,
+                                ReductionKernel<T> reduction_kernel,
+                                double density_threshold = SparseAllreduceSettings::density_threshold);
+
+        // Number of entries of the result, once the collective has finished
+        std::size_t getOutputCount() override;
+
+      private:
+        enum class AlgStage
+        {
+          RECEIVE_INPUT_NON_POWER_TWO,
+          EXCHANGE,
+          RECEIVE_RESULT_NON_POWER_TWO,
+          WAIT_FOR_ACKS,
+        };
+
+        struct Header
+        {
+          std::uint64_t is_dense;
+          std::uint64_t number_entries;
+        };
+
+        gaspi::group::Group group;
+        std::size_t number_elements;
+        reduction::Kernel reduction_kernel;
+        std::size_t max_number_sparse_entries;
+
+        std::size_t number_ranks;
+        std::size_t number_ranks_used;
+        std::size_t number_ranks_rest;
+        gaspi::group::Rank rank;
+
+        // current vector, either sparse or dense
+        bool is_dense;
+        SparseVector<T> entries;
+        std::vector<T> dense_values;
+        // scratch space for merging
+        SparseVector<T> received_entries;
+        SparseVector<T> merged_entries;
+
+        std::vector<std::unique_ptr<SourceBuffer>> source_buffers;
+        std::vector<std::unique_ptr<TargetBuffer>> target_buffers;
+        std::unique_ptr<SourceBuffer> source_buffer_non_power_two_case;
+        std::unique_ptr<TargetBuffer> target_buffer_non_power_two_case;
+        std::vector<ConnectHandle> handles;
+        // sources of the current run, whose transfers are yet to be acknowledged
+        std::vector<SourceBuffer*> sent_buffers;
+
+        std::size_t iteration;
+        std::size_t number_iterations;
+        AlgStage alg_stage;
+
+        void waitForSetupImpl() override;
+        void copyInImpl(void const*) override;
+        void copyOutImpl(void*) override;
+
+        void startImpl() override;
+        bool triggerProgressImpl() override;
+
+        // algorithm-specific methods
+        bool is_extra_rank() const;
+        bool is_even_non_extra_rank() const;
+        bool is_odd_non_extra_rank() const;
+        gaspi::group::Rank get_neighbor(std::size_t iteration) const;
+
+        void reduce_entry(T& inout, T const& input) const;
+        void convert_to_dense();
+        void send_payload(SourceBuffer& buffer);
+        void merge_payload(void const* payload);
+        void read_payload(void const* payload);
+    };
+
+    template<typename T>
+    SparseAllreduceLowLevel<T>::SparseAllreduceLowLevel(
+                      gaspi::group::Group const& group,
+                      std::size_t number_elements,
+                      ReductionKernel<T> reduction_kernel,
+                      double density_threshold)
+    : CollectiveLowLevel(),
+      group(group),
+      number_elements(number_elements),
+      reduction_kernel(reduction_kernel.get_untyped_kernel()),
+      max_number_sparse_entries(static_cast<std::size_t>(
+        std::max(density_threshold, 0.0) * static_cast<double>(number_elements))),
+      number_ranks(group.size()),
+      number_ranks_used(nearest_power_of_two_less_equal(number_ranks)),
+      number_ranks_rest(number_ranks - number_ranks_used),
+      rank(group.rank()),
+      is_dense(false),
+      entries(), dense_values(), received_entries(), merged_entries(),
+      source_buffers(), target_buffers(),
+      source_buffer_non_power_two_case(), target_buffer_non_power_two_case(),
+      handles(),
+      sent_buffers(),
+      iteration(0),
+      number_iterations(static_cast<std::size_t>(std::log2(number_ranks_used))),
+      alg_stage(AlgStage::EXCHANGE)
+    {
+      if (number_elements > std::numeric_limits<Index>::max())
+      {
+        throw std::logic_error("SparseAllreduceLowLevel: Too many elements for the index type");
+      }
+      max_number_sparse_entries = std::min(max_number_sparse_entries, number_elements);
+
+      if (number_ranks > 1)
+      {
+        auto const size_buffer_bytes = sizeof(Header) +
+          std::max(sizeof(T) * number_elements,
+                   (sizeof(Index) + sizeof(T)) * max_number_sparse_entries);
+
+        if (!is_odd_non_extra_rank())
+        {
+          for (auto iteration = 0UL; iteration < number_iterations; ++iteration)
+          {
+            source_buffers.push_back(std::make_unique<SourceBuffer>(size_buffer_bytes));
+            target_buffers.push_back(std::make_unique<TargetBuffer>(size_buffer_bytes));
+
+            auto const neighbor = get_neighbor(iteration);
+            auto const source_tag = SourceBuffer::Tag(iteration);
+            auto const target_tag = TargetBuffer::Tag(iteration);
+            handles.push_back(
+              source_buffers[iteration]->connectToRemoteTarget(group, neighbor, source_tag));
+            handles.push_back(
+              target_buffers[iteration]->connectToRemoteSource(group, neighbor, target_tag));
+          }
+        }
+
+        if (!is_extra_rank())
+        {
+          source_buffer_non_power_two_case = std::make_unique<SourceBuffer>(size_buffer_bytes);
+          target_buffer_non_power_two_case = std::make_unique<TargetBuffer>(size_buffer_bytes);
+
+          auto const neighbor = group::Rank(rank.get() ^ 1); // next rank when even, previous otherwise
+          auto const source_tag = SourceBuffer::Tag(number_iterations);
+          auto const target_tag = TargetBuffer::Tag(number_iterations);
+          handles.push_back(
+            source_buffer_non_power_two_case->connectToRemoteTarget(group, neighbor, source_tag));
+          handles.push_back(
+            target_buffer_non_power_two_case->connectToRemoteSource(group, neighbor, target_tag));
+        }
+      }
+    }
+
+    template<typename T>
+    void SparseAllreduceLowLevel<T>::waitForSetupImpl()
+    {
+      for (auto& handle : handles)
+      {
+        handle.waitForCompletion();
+      }
+    }
+
+    template<typename T>
+    void SparseAllreduceLowLevel<T>::startImpl()
+    {
+      if (number_ranks == 1) { return; }
+
+      iteration = 0;
+      sent_buffers.clear();
+      if (is_odd_non_extra_rank())
+      {
+        send_payload(*source_buffer_non_power_two_case);
+        alg_stage = AlgStage::RECEIVE_RESULT_NON_POWER_TWO;
+      }
+      else if (is_even_non_extra_rank())
+      {
+        alg_stage = AlgStage::RECEIVE_INPUT_NON_POWER_TWO;
+      }
+      else
+      {
+        send_payload(*source_buffers[iteration]);
+        alg_stage = AlgStage::EXCHANGE;
+      }
+    }
+
+    // Received payloads are acknowledged once they have been read, and a run
+    // finishes only after all sent payloads have been acknowledged, such that
+    // no buffer is overwritten by the next run while still in use.
+    template<typename T>
+    bool SparseAllreduceLowLevel<T>::triggerProgressImpl()
+    {
+      if (number_ranks == 1) { return true; }
+
+      if (alg_stage == AlgStage::RECEIVE_INPUT_NON_POWER_TWO)
+      {
+        if (!target_buffer_non_power_two_case->checkForCompletion()) { return false; }
+
+        merge_payload(target_buffer_non_power_two_case->address());
+        target_buffer_non_power_two_case->ackTransfer();
+        send_payload(*source_buffers[iteration]);
+        alg_stage = AlgStage::EXCHANGE;
+      }
+
+      if (alg_stage == AlgStage::EXCHANGE)
+      {
+        while (iteration < number_iterations)
+        {
+          if (!target_buffers[iteration]->checkForCompletion()) { return false; }
+
+          merge_payload(target_buffers[iteration]->address());
+          target_buffers[iteration]->ackTransfer();
+          iteration++;
+          if (iteration < number_iterations)
+          {
+            send_payload(*source_buffers[iteration]);
+          }
+        }
+
+        // Send results back to non-active ranks
+        if (is_even_non_extra_rank())
+        {
+          send_payload(*source_buffer_non_power_two_case);
+        }
+        alg_stage = AlgStage::WAIT_FOR_ACKS;
+      }
+
+      if (alg_stage == AlgStage::RECEIVE_RESULT_NON_POWER_TWO)
+      {
+        if (!target_buffer_non_power_two_case->checkForCompletion()) { return false; }
+
+        read_payload(target_buffer_non_power_two_case->address());
+        target_buffer_non_power_two_case->ackTransfer();
+        alg_stage = AlgStage::WAIT_FOR_ACKS;
+      }
+
+      while (!sent_buffers.empty())
+      {
+        if (!sent_buffers.back()->checkForTransferAck()) { return false; }
+        sent_buffers.pop_back();
+      }
+      return true;
+    }
+
+    template<typename T>
+    void SparseAllreduceLowLevel<T>::copyInImpl(void const* inputs)
+    {
+      auto const& input_vector = *static_cast<SparseVector<T> const*>(inputs);
+      auto const number_entries = input_vector.indices.size();
+      if (input_vector.values.size() != number_entries)
+      {
+        throw std::logic_error("SparseAllreduceLowLevel: Different numbers of indices and values");
+      }
+      if (std::any_of(input_vector.indices.begin(), input_vector.indices.end(),
+                      [this](Index index) { return index >= number_elements; }))
+      {
+        throw std::logic_error("SparseAllreduceLowLevel: Index out of range");
+      }
+
+      // sort entries by index, and reduce repeated ones
+      std::vector<std::size_t> order(number_entries);
+      std::iota(order.begin(), order.end(), 0UL);
+      std::stable_sort(order.begin(), order.end(),
+                       [&input_vector](std::size_t a, std::size_t b)
+                       { return input_vector.indices[a] < input_vector.indices[b]; });
+
+      is_dense = false;
+      entries.indices.clear();
+      entries.values.clear();
+      for (auto const i : order)
+      {
+        if (!entries.indices.empty() && entries.indices.back() == input_vector.indices[i])
+        {
+          reduce_entry(entries.values.back(), input_vector.values[i]);
+          continue;
+        }
+        entries.indices.push_back(input_vector.indices[i]);
+        entries.values.push_back(input_vector.values[i]);
+      }
+
+      if (entries.indices.size() > max_number_sparse_entries)
+      {
+        convert_to_dense();
+      }
+    }
+
+    template<typename T>
+    void SparseAllreduceLowLevel<T>::copyOutImpl(void* outputs)
+    {
+      auto& output_vector = *static_cast<SparseVector<T>*>(outputs);
+      if (is_dense)
+      {
+        output_vector.indices.resize(number_elements);
+        std::iota(output_vector.indices.begin(), output_vector.indices.end(), Index(0));
+        output_vector.values = dense_values;
+      }
+      else
+      {
+        output_vector = entries;
+      }
+    }
+
+    template<typename T>
+    std::size_t SparseAllreduceLowLevel<T>::getOutputCount()
+    {
+      return is_dense ? number_elements : entries.indices.size();
+    }
+
+    template<typename T>
+    bool SparseAllreduceLowLevel<T>::is_extra_rank() const
+    {
+      return rank.get() >= 2 * number_ranks_rest;
+    }
+
+    template<typename T>
+    bool SparseAllreduceLowLevel<T>::is_even_non_extra_rank() const
+    {
+      return (rank.get() % 2 == 0) && !is_extra_rank();
+    }
+
+    template<typename T>
+    bool SparseAllreduceLowLevel<T>::is_odd_non_extra_rank() const
+    {
+      return (rank.get() % 2 == 1) && !is_extra_rank();
+    }
+
+    template<typename T>
+    gaspi::group::Rank SparseAllreduceLowLevel<T>::get_neighbor(std::size_t iteration) const
+    {
+      auto const distance = static_cast<std::size_t>(std::exp2(iteration));
+      auto const relabeled_rank = rank.get() < 2 * number_ranks_rest ?
+                                    rank.get() / 2 : rank.get() - number_ranks_rest;
+      auto const relabeled_neighbor = relabeled_rank ^ distance; // +/- distance
+      return relabeled_neighbor < number_ranks_rest ?
+               group::Rank(relabeled_neighbor * 2) :
+               group::Rank(relabeled_neighbor + number_ranks_rest);
+    }
+
+    template<typename T>
+    void SparseAllreduceLowLevel<T>::reduce_entry(T& inout, T const& input) const
+    {
+      reduction_kernel(&inout, &input, 1);
+    }
+
+    template<typename T>
+    void SparseAllreduceLowLevel<T>::convert_to_dense()
+    {
+      dense_values.assign(number_elements, T(0));
+      for (auto i = 0UL; i < entries.indices.size(); ++i)
+      {
+        dense_values[entries.indices[i]] = entries.values[i];
+      }
+      is_dense = true;
+    }
+
+    template<typename T>
+    void SparseAllreduceLowLevel<T>::send_payload(SourceBuffer& buffer)
+    {
+      Header const header { is_dense, is_dense ? number_elements : entries.indices.size() };
+      auto const payload = static_cast<char*>(buffer.address());
+      std::memcpy(payload, &header, sizeof(Header));
+
+      auto size_payload = sizeof(Header);
+      if (is_dense)
+      {
+        std::memcpy(payload + size_payload, dense_values.data(), sizeof(T) * number_elements);
+        size_payload += sizeof(T) * number_elements;
+      }
+      else
+      {
+        auto const number_entries = entries.indices.size();
+        std::memcpy(payload + size_payload, entries.indices.data(), sizeof(Index) * number_entries);
+        size_payload += sizeof(Index) * number_entries;
+        std::memcpy(payload + size_payload, entries.values.data(), sizeof(T) * number_entries);
+        size_payload += sizeof(T) * number_entries;
+      }
+
+      buffer.initTransferPart(size_payload, 0);
+      sent_buffers.push_back(&buffer);
+    }
+
+    template<typename T>
+    void SparseAllreduceLowLevel<T>::merge_payload(void const* payload)
+    {
+      auto const bytes = static_cast<char const*>(payload);
+      Header header;
+      std::memcpy(&header, bytes, sizeof(Header));
+      auto const number_entries = header.number_entries;
+
+      if (header.is_dense)
+      {
+        if (!is_dense) { convert_to_dense(); }
+        auto& received_values = received_entries.values;
+        received_values.resize(number_elements);
+        std::memcpy(received_values.data(), bytes + sizeof(Header), sizeof(T) * number_elements);
+        reduction_kernel(dense_values.data(), received_values.data(), number_elements);
+        return;
+      }
+
+      auto& received = received_entries;
+      received.indices.resize(number_entries);
+      received.values.resize(number_entries);
+      std::memcpy(received.indices.data(), bytes + sizeof(Header), sizeof(Index) * number_entries);
+      std::memcpy(received.values.data(), bytes + sizeof(Header) + sizeof(Index) * number_entries,
+                  sizeof(T) * number_entries);
+
+      if (is_dense)
+      {
+        for (auto i = 0UL; i < number_entries; ++i)
+        {
+          reduce_entry(dense_values[received.indices[i]], received.values[i]);
+        }
+        return;
+      }
+
+      // merge both sorted sequences of entries
+      auto& merged = merged_entries;
+      merged.indices.clear();
+      merged.values.clear();
+      merged.indices.reserve(entries.indices.size() + number_entries);
+      merged.values.reserve(entries.indices.size() + number_entries);
+      auto i = 0UL;
+      auto j = 0UL;
+      while (i < entries.indices.size() || j < number_entries)
+      {
+        if (j == number_entries ||
+            (i < entries.indices.size() && entries.indices[i] < received.indices[j]))
+        {
+          merged.indices.push_back(entries.indices[i]);
+          merged.values.push_back(entries.values[i++]);
+        }
+        else if (i == entries.indices.size() || received.indices[j] < entries.indices[i])
+        {
+          merged.indices.push_back(received.indices[j]);
+          merged.values.push_back(received.values[j++]);
+        }
+        else
+        {
+          merged.indices.push_back(entries.indices[i]);
+          merged.values.push_back(entries.values[i++]);
+          reduce_entry(merged.values.back(), received.values[j++]);
+        }
+      }
+      std::swap(entries, merged);
+
+      if (entries.indices.size() > max_number_sparse_entries)
+      {
+        convert_to_dense();
+      }
+    }
+
+    template<typename T>
+    void SparseAllreduceLowLevel<T>::read_payload(void const* payload)
+    {
+      is_dense = false;
+      entries.indices.clear();
+      entries.values.clear();
+      merge_payload(payload);
+    }
+  }
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Tuning.hpp
+ *
+ */
+
+#pragma once
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AlgorithmSelection.hpp>
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    // Tuning files
+    // ============
+    // A tuning file stores one selection table per collective
+    // (e.g., "allreduce", "broadcast", "allgatherv"), as generated by
+    // the `collectives-tuner` tool on the target machine.
+    //
+    // Format: one line `<collective> <selection table>` per collective,
+    // where `#` starts a comment, e.g.,
+    //   # measured on 2 nodes
+    //   allreduce 4:16384:recursivedoubling,*:*:ring
+    //   broadcast *:*:sendtoall
+
+    // Environment variable giving the path of the tuning file
+    inline constexpr char const* tuning_file_variable = "GASPICXX_TUNING_FILE";
+
+    using TuningTables = std::map<std::string, SelectionTable>;
+
+    TuningTables parse_tuning_tables(std::string const& description);
+    std::string to_string(TuningTables const& tables);
+
+    TuningTables read_tuning_file(std::string const& path);
+    void write_tuning_file(std::string const& path, TuningTables const& tables);
+
+    // Tuning file taken from (in order of precedence)
+    //  - the environment variable `tuning_file_variable`,
+    //  - the runtime configuration (`RuntimeConfiguration::set_tuning_file`);
+    // empty if none is given
+    std::string get_tuning_file();
+
+    // Table of the `collective` stored in the tuning file (empty if there is none)
+    SelectionTable get_tuned_selection_table(std::string const& collective);
+
+    // Algorithm stored in the tuning file for the `collective`,
+    // or `fallback` if there is no matching rule
+    template<typename Info>
+    typename Info::Algorithm select_tuned_algorithm(std::string const& collective,
+                                                    std::size_t number_ranks,
+                                                    std::size_t message_bytes,
+                                                    typename Info::Algorithm fallback)
+    {
+      auto const table = get_tuned_selection_table(collective);
+      for (auto const& rule : table)
+      {
+        if (number_ranks <= rule.max_number_ranks && message_bytes <= rule.max_message_bytes)
+        {
+          return get_algorithm_by_name<Info>(rule.algorithm);
+        }
+      }
+      return fallback;
+    }
+
+    // Average run time of an algorithm for a given group size and message size
+    struct TuningMeasurement
+    {
+      std::size_t number_ranks;
+      std::size_t message_bytes;
+      std::string algorithm;
+      double time;
+    };
+
+    // Builds a selection table choosing the fastest measured algorithm.
+    // The table covers all group sizes and message sizes: a size is handled
+    // like the smallest measured size not below it, and sizes beyond the
+    // largest measured one like the largest one.
+    SelectionTable build_selection_table(std::vector<TuningMeasurement> const& measurements);
+  }
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Utilities.hpp
+ *
+ */
+
+#pragma once
+
+#include <cmath>
+#include <type_traits>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    namespace
+    {
+      template <typename Integer,
+                std::enable_if_t<std::is_integral<Integer>::value, bool> = true>
+      Integer ceil_div(Integer a, Integer b)
+      {
+        return (a + b - 1) / b;
+      }
+
+      template <typename Integer,
+                std::enable_if_t<std::is_integral<Integer>::value, bool> = true>
+      Integer nearest_power_of_two_less_equal(Integer i)
+      {
+        auto const exponent = std::trunc(std::log2(i));
+        auto const power = std::pow(2, exponent);
+        return static_cast<Integer>(power);
+      }
+    }
+  }
+}
@@ -109,7 +109,9 @@ namespace gaspi
         CommunicationContextType communication_context_type)
   : segment_pool_type(segment_pool_type),
     progress_engine_type(progress_engine_type),
-    communication_context_type(communication_context_type)
+    communication_context_type(communication_context_type),
+    allreduce_selection(),
+    tuning_file()
   { }
 
   std::unique_ptr<segment::SegmentPool>
@@ -130,4 +132,28 @@ namespace gaspi
     return CommunicationContextFactory::createCommunicationContext(
                                         communication_context_type);
   }
+
+  void
+  RuntimeConfiguration::set_allreduce_selection(std::string const& selection)
+  {
+    allreduce_selection = selection;
+  }
+
+  std::string const&
+  RuntimeConfiguration::get_allreduce_selection() const
+  {
+    return allreduce_selection;
+  }
+
+  void
+  RuntimeConfiguration::set_tuning_file(std::string const& path)
+  {
+    tuning_file = path;
+  }
+
+  std::string const&
+  RuntimeConfiguration::get_tuning_file() const
+  {
+    return tuning_file;
+  }
 }
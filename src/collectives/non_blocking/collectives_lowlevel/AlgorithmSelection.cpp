@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * AlgorithmSelection.cpp
+ *
+ */
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AlgorithmSelection.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <sstream>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    namespace
+    {
+      std::size_t parse_bound(std::string const& bound, std::string const& rule)
+      {
+        if (bound == "*")
+        {
+          return SelectionRule::unbounded;
+        }
+        if (bound.empty() ||
+            !std::all_of(bound.begin(), bound.end(), [](unsigned char c) { return std::isdigit(c); }))
+        {
+          throw std::logic_error("parse_selection_table: Invalid bound in rule " + rule);
+        }
+        return std::stoul(bound);
+      }
+
+      std::string bound_to_string(std::size_t bound)
+      {
+        return bound == SelectionRule::unbounded ? "*" : std::to_string(bound);
+      }
+    }
+
+    SelectionTable parse_selection_table(std::string const& description)
+    {
+      auto rules = description;
+      std::replace(rules.begin(), rules.end(), ',', ' ');
+
+      SelectionTable table;
+      std::istringstream stream(rules);
+      std::string rule;
+      while (stream >> rule)
+      {
+        auto const first_colon = rule.find(':');
+        auto const second_colon = first_colon == std::string::npos ?
+                                    std::string::npos : rule.find(':', first_colon + 1);
+        if (second_colon == std::string::npos)
+        {
+          throw std::logic_error("parse_selection_table: Invalid rule " + rule);
+        }
+
+        table.push_back({parse_bound(rule.substr(0, first_colon), rule),
+                         parse_bound(rule.substr(first_colon + 1, second_colon - first_colon - 1), rule),
+                         rule.substr(second_colon + 1)});
+      }
+      return table;
+    }
+
+    std::string to_string(SelectionTable const& table)
+    {
+      std::string description;
+      for (auto const& rule : table)
+      {
+        if (!description.empty()) { description += ","; }
+        description += bound_to_string(rule.max_number_ranks) + ":" +
+                       bound_to_string(rule.max_message_bytes) + ":" +
+                       rule.algorithm;
+      }
+      return description;
+    }
+
+    std::string const& select_algorithm_name(SelectionTable const& table,
+                                             std::size_t number_ranks,
+                                             std::size_t message_bytes)
+    {
+      for (auto const& rule : table)
+      {
+        if (number_ranks <= rule.max_number_ranks && message_bytes <= rule.max_message_bytes)
+        {
+          return rule.algorithm;
+        }
+      }
+      throw std::logic_error("select_algorithm_name: No rule matches " +
+                             std::to_string(number_ranks) + " ranks and " +
+                             std::to_string(message_bytes) + " bytes");
+    }
+  }
+}
@@ -21,6 +21,7 @@
 
 #include <GaspiCxx/Runtime.hpp>
 #include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllgathervCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllgathervRing.hpp>
 #include <numeric>
 
 namespace gaspi
@@ -43,5 +44,19 @@ namespace gaspi
     {
       return number_elements;
     }
+
+    std::vector<std::size_t> allgather_counts(gaspi::group::Group const& group,
+                                              std::size_t count)
+    {
+      std::vector<std::size_t> counts(group.size(), 0);
+      std::vector<std::size_t> counter(group.size(), 1);
+      AllgathervLowLevel<std::size_t, AllgathervAlgorithm::RING> allgatherv_count(group, counter);
+      allgatherv_count.waitForSetup();
+      allgatherv_count.copyIn(&count);
+      allgatherv_count.start();
+      allgatherv_count.waitForCompletion();
+      allgatherv_count.copyOut(counts.data());
+      return counts;
+    }
   }
 }
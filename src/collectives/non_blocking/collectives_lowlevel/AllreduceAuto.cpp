@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * AllreduceAuto.cpp
+ *
+ */
+
+#include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceAuto.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/Tuning.hpp>
+
+#include <cstdlib>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    SelectionTable const& get_builtin_allreduce_selection_table()
+    {
+      auto const unbounded = SelectionRule::unbounded;
+      static SelectionTable const table
+        { {4, 16 * 1024, "recursivedoubling"},
+          {4, unbounded, "ring"},
+          {16, 8 * 1024, "recursivedoubling"},
+          {16, 256 * 1024, "rabenseifner"},
+          {16, unbounded, "ring"},
+          {unbounded, 4 * 1024, "recursivedoubling"},
+          {unbounded, 1024 * 1024, "rabenseifner"},
+          {unbounded, unbounded, "ring"} };
+      return table;
+    }
+
+    SelectionTable get_allreduce_selection_table()
+    {
+      auto const environment_selection = std::getenv(allreduce_selection_variable);
+      if (environment_selection != nullptr && *environment_selection != '\0')
+      {
+        return parse_selection_table(environment_selection);
+      }
+
+      auto const& configured_selection = Runtime::configuration.get_allreduce_selection();
+      if (!configured_selection.empty())
+      {
+        return parse_selection_table(configured_selection);
+      }
+
+      auto tuned_selection = get_tuned_selection_table("allreduce");
+      if (!tuned_selection.empty())
+      {
+        return tuned_selection;
+      }
+      return get_builtin_allreduce_selection_table();
+    }
+
+    AllreduceAlgorithm select_allreduce_algorithm(std::size_t number_ranks,
+                                                  std::size_t message_bytes)
+    {
+      auto const table = get_allreduce_selection_table();
+      return get_algorithm_by_name<AllreduceInfo>(
+               select_algorithm_name(table, number_ranks, message_bytes));
+    }
+  }
+}
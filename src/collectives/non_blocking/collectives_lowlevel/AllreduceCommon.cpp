@@ -22,16 +22,18 @@
 #include <GaspiCxx/Runtime.hpp>
 #include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceCommon.hpp>
 
+#include <utility>
+
 namespace gaspi
 {
   namespace collectives
   {
     AllreduceCommon::AllreduceCommon(gaspi::group::Group const& group,
                                      std::size_t number_elements,
-                                     ReductionOp reduction_op)
+                                     reduction::Kernel reduction_kernel)
     : group(group),
       number_elements(number_elements),
-      reduction_op(reduction_op)
+      reduction_kernel(std::move(reduction_kernel))
     { }
 
     std::size_t AllreduceCommon::getOutputCount()
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * AlltoallvAuto.cpp
+ *
+ */
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AlltoallvAuto.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/Tuning.hpp>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    SelectionTable const& get_builtin_alltoallv_selection_table()
+    {
+      auto const unbounded = SelectionRule::unbounded;
+      static SelectionTable const table
+        { {unbounded, 8 * 1024, "bruck"},
+          {unbounded, unbounded, "pairwiseexchange"} };
+      return table;
+    }
+
+    SelectionTable get_alltoallv_selection_table()
+    {
+      auto tuned_selection = get_tuned_selection_table("alltoallv");
+      if (!tuned_selection.empty())
+      {
+        return tuned_selection;
+      }
+      return get_builtin_alltoallv_selection_table();
+    }
+
+    AlltoallvAlgorithm select_alltoallv_algorithm(std::size_t number_ranks,
+                                                  std::size_t message_bytes)
+    {
+      auto const table = get_alltoallv_selection_table();
+      return get_algorithm_by_name<AlltoallvInfo>(
+               select_algorithm_name(table, number_ranks, message_bytes));
+    }
+  }
+}
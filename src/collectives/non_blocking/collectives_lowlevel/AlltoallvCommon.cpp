@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * AlltoallvCommon.cpp
+ *
+ */
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AlltoallvCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AlltoallvPairwiseExchange.hpp>
+
+#include <numeric>
+#include <stdexcept>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    namespace
+    {
+      std::vector<std::size_t> get_offsets(std::vector<std::size_t> const& counts)
+      {
+        std::vector<std::size_t> offsets(counts.size(), 0);
+        if (counts.size() > 1)
+        {
+          std::partial_sum(counts.begin(), counts.end() - 1, offsets.begin() + 1);
+        }
+        return offsets;
+      }
+    }
+
+    AlltoallvCommon::AlltoallvCommon(gaspi::group::Group const& group,
+                                     std::vector<std::size_t> const& send_counts,
+                                     std::vector<std::size_t> const& recv_counts)
+    : group(group),
+      send_counts(send_counts),
+      send_offsets(get_offsets(send_counts)),
+      recv_counts(recv_counts),
+      recv_offsets(get_offsets(recv_counts)),
+      number_send_elements(std::accumulate(send_counts.begin(), send_counts.end(), 0UL)),
+      number_recv_elements(std::accumulate(recv_counts.begin(), recv_counts.end(), 0UL))
+    {
+      if (send_counts.size() != group.size() || recv_counts.size() != group.size())
+      {
+        throw std::logic_error(
+          "AlltoallvCommon: `send_counts` and `recv_counts` must contain one count per rank");
+      }
+      if (send_counts[group.rank().get()] != recv_counts[group.rank().get()])
+      {
+        throw std::logic_error(
+          "AlltoallvCommon: The block sent to the own rank has to match the received one");
+      }
+    }
+
+    std::size_t AlltoallvCommon::getOutputCount()
+    {
+      return number_recv_elements;
+    }
+
+    std::vector<std::size_t> alltoall_counts(gaspi::group::Group const& group,
+                                             std::vector<std::size_t> const& send_counts)
+    {
+      if (send_counts.size() != group.size())
+      {
+        throw std::logic_error("alltoall_counts: `send_counts` must contain one count per rank");
+      }
+
+      std::vector<std::size_t> recv_counts(group.size(), 0);
+      std::vector<std::size_t> const counter(group.size(), 1);
+      AlltoallvLowLevel<std::size_t, AlltoallvAlgorithm::PAIRWISE_EXCHANGE> alltoall_count(
+        group, counter, counter);
+      alltoall_count.waitForSetup();
+      alltoall_count.copyIn(send_counts.data());
+      alltoall_count.start();
+      alltoall_count.waitForCompletion();
+      alltoall_count.copyOut(recv_counts.data());
+      return recv_counts;
+    }
+  }
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * BarrierCommon.cpp
+ *
+ */
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/BarrierCommon.hpp>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    BarrierCommon::BarrierCommon(gaspi::group::Group const& group)
+    : group(group)
+    { }
+
+    std::size_t BarrierCommon::getOutputCount()
+    {
+      return 0;
+    }
+
+    void BarrierCommon::copyInImpl(void const*)
+    { }
+
+    void BarrierCommon::copyOutImpl(void*)
+    { }
+  }
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * BarrierDissemination.cpp
+ *
+ */
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/BarrierDissemination.hpp>
+
+#include <algorithm>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    BarrierLowLevel<BarrierAlgorithm::DISSEMINATION>::BarrierLowLevel(
+                      gaspi::group::Group const& group)
+    : BarrierCommon(group),
+      source_buffers(),
+      target_buffers(),
+      handles(),
+      step(0),
+      is_acknowledged(),
+      number_acknowledged(0)
+    {
+      auto const rank = group.rank().get();
+      auto const number_ranks = group.size();
+      auto const zero_size = 0UL;
+
+      auto step_index = 0;
+      for (auto distance = 1UL; distance < number_ranks; distance <<= 1, ++step_index)
+      {
+        auto const next_rank = gaspi::group::Rank((rank + distance) % number_ranks);
+        auto const previous_rank = gaspi::group::Rank((rank + number_ranks - distance) % number_ranks);
+
+        source_buffers.push_back(std::make_unique<SourceBuffer>(zero_size));
+        target_buffers.push_back(std::make_unique<TargetBuffer>(zero_size));
+        handles.push_back(source_buffers.back()->connectToRemoteTarget(
+                            group, next_rank, SourceBuffer::Tag(step_index)));
+        handles.push_back(target_buffers.back()->connectToRemoteSource(
+                            group, previous_rank, TargetBuffer::Tag(step_index)));
+      }
+      is_acknowledged.resize(source_buffers.size(), false);
+      step = source_buffers.size();
+    }
+
+    void BarrierLowLevel<BarrierAlgorithm::DISSEMINATION>::waitForSetupImpl()
+    {
+      for (auto& handle : handles)
+      {
+        handle.waitForCompletion();
+      }
+    }
+
+    void BarrierLowLevel<BarrierAlgorithm::DISSEMINATION>::startImpl()
+    {
+      std::fill(is_acknowledged.begin(), is_acknowledged.end(), false);
+      number_acknowledged = 0;
+      step = 0;
+      if (step < source_buffers.size())
+      {
+        notify_next_rank();
+      }
+    }
+
+    bool BarrierLowLevel<BarrierAlgorithm::DISSEMINATION>::triggerProgressImpl()
+    {
+      while (step < target_buffers.size())
+      {
+        if (!target_buffers[step]->checkForCompletion()) { return false; }
+        target_buffers[step]->ackTransfer();
+
+        step++;
+        if (step < source_buffers.size())
+        {
+          notify_next_rank();
+        }
+      }
+
+      // the notifications are reused in the next run
+      for (auto i = 0UL; i < source_buffers.size(); ++i)
+      {
+        if (is_acknowledged[i] || !source_buffers[i]->checkForTransferAck()) { continue; }
+
+        is_acknowledged[i] = true;
+        number_acknowledged++;
+      }
+      return number_acknowledged == source_buffers.size();
+    }
+
+    void BarrierLowLevel<BarrierAlgorithm::DISSEMINATION>::notify_next_rank()
+    {
+      source_buffers[step]->initTransfer();
+    }
+  }
+}
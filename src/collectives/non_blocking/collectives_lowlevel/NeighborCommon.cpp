@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * NeighborCommon.cpp
+ *
+ */
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/NeighborCommon.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    namespace
+    {
+      bool are_group_ranks(std::vector<gaspi::group::Rank> const& ranks,
+                           gaspi::group::Group const& group)
+      {
+        return std::all_of(ranks.begin(), ranks.end(),
+                           [&group](auto const& rank) { return rank.get() < group.size(); });
+      }
+    }
+
+    NeighborGraph make_symmetric_graph(std::vector<gaspi::group::Rank> const& neighbors)
+    {
+      return {neighbors, neighbors};
+    }
+
+    NeighborCommon::NeighborCommon(gaspi::group::Group const& group,
+                                   NeighborGraph const& graph,
+                                   std::vector<std::size_t> const& send_counts,
+                                   std::vector<std::size_t> const& send_offsets,
+                                   std::vector<std::size_t> const& recv_counts)
+    : group(group),
+      graph(graph),
+      send_counts(send_counts),
+      send_offsets(send_offsets),
+      recv_counts(recv_counts),
+      recv_offsets(get_offsets(recv_counts)),
+      number_send_elements(0),
+      number_recv_elements(std::accumulate(recv_counts.begin(), recv_counts.end(), 0UL))
+    {
+      if (send_counts.size() != graph.destinations.size() ||
+          send_offsets.size() != graph.destinations.size() ||
+          recv_counts.size() != graph.sources.size())
+      {
+        throw std::logic_error(
+          "NeighborCommon: `send_counts` and `recv_counts` must contain one count per edge");
+      }
+      if (!are_group_ranks(graph.sources, group) || !are_group_ranks(graph.destinations, group))
+      {
+        throw std::logic_error("NeighborCommon: Graph contains ranks outside of the group");
+      }
+
+      for (auto i = 0UL; i < send_counts.size(); ++i)
+      {
+        number_send_elements = std::max(number_send_elements, send_offsets[i] + send_counts[i]);
+      }
+    }
+
+    std::size_t NeighborCommon::getOutputCount()
+    {
+      return number_recv_elements;
+    }
+
+    std::vector<std::size_t> NeighborCommon::get_offsets(std::vector<std::size_t> const& counts)
+    {
+      std::vector<std::size_t> offsets(counts.size(), 0);
+      if (counts.size() > 1)
+      {
+        std::partial_sum(counts.begin(), counts.end() - 1, offsets.begin() + 1);
+      }
+      return offsets;
+    }
+
+    std::vector<std::size_t> NeighborCommon::get_edge_tags(
+                              std::vector<gaspi::group::Rank> const& ranks)
+    {
+      std::vector<std::size_t> tags;
+      for (auto i = 0UL; i < ranks.size(); ++i)
+      {
+        tags.push_back(std::count(ranks.begin(), ranks.begin() + i, ranks[i]));
+      }
+      return tags;
+    }
+  }
+}
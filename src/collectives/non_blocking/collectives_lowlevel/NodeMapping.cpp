@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * NodeMapping.cpp
+ *
+ */
+
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllgathervRing.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/NodeMapping.hpp>
+
+#include <unistd.h>
+
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    namespace
+    {
+      constexpr std::size_t max_hostname_length = 256;
+    }
+
+    std::vector<std::size_t> get_node_ids(gaspi::group::Group const& group)
+    {
+      std::array<char, max_hostname_length> hostname {};
+      if (gethostname(hostname.data(), hostname.size() - 1) != 0)
+      {
+        throw std::runtime_error("get_node_ids: Cannot determine host name");
+      }
+
+      auto const number_ranks = group.size();
+      std::vector<char> hostnames(number_ranks * max_hostname_length);
+      AllgathervLowLevel<char, AllgathervAlgorithm::RING> allgatherv(
+        group, std::vector<std::size_t>(number_ranks, max_hostname_length));
+      allgatherv.waitForSetup();
+      allgatherv.copyIn(hostname.data());
+      allgatherv.start();
+      allgatherv.waitForCompletion();
+      allgatherv.copyOut(hostnames.data());
+
+      std::unordered_map<std::string, std::size_t> node_id_by_hostname;
+      std::vector<std::size_t> node_ids;
+      for (auto i = 0UL; i < number_ranks; ++i)
+      {
+        std::string const name(hostnames.data() + i * max_hostname_length);
+        auto const node_id = node_id_by_hostname.size();
+        node_ids.push_back(node_id_by_hostname.emplace(name, node_id).first->second);
+      }
+      return node_ids;
+    }
+  }
+}
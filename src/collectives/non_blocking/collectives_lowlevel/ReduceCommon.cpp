@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ReduceCommon.cpp
+ *
+ */
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/ReduceCommon.hpp>
+
+#include <stdexcept>
+#include <utility>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    ReduceCommon::ReduceCommon(gaspi::group::Group const& group,
+                               std::size_t number_elements,
+                               gaspi::group::Rank const& root,
+                               reduction::Kernel reduction_kernel)
+    : group(group),
+      number_elements(number_elements),
+      root(root),
+      reduction_kernel(std::move(reduction_kernel))
+    {
+      if (!group.contains_rank(root))
+      {
+        throw std::logic_error("ReduceCommon: `group` must contain `root`");
+      }
+    }
+
+    std::size_t ReduceCommon::getOutputCount()
+    {
+      return group.rank() == root ? number_elements : 0;
+    }
+  }
+}
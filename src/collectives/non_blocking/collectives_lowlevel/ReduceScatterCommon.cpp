@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ReduceScatterCommon.cpp
+ *
+ */
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/ReduceScatterCommon.hpp>
+
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    ReduceScatterCommon::ReduceScatterCommon(gaspi::group::Group const& group,
+                                             std::vector<std::size_t> const& counts,
+                                             reduction::Kernel reduction_kernel)
+    : group(group),
+      counts(counts),
+      offsets(counts.size(), 0),
+      number_elements(std::accumulate(counts.begin(), counts.end(), 0UL)),
+      reduction_kernel(std::move(reduction_kernel))
+    {
+      if (counts.size() != group.size())
+      {
+        throw std::logic_error("ReduceScatterCommon: `counts` must contain one count per rank");
+      }
+      if (counts.size() > 1)
+      {
+        std::partial_sum(counts.begin(), counts.end() - 1, offsets.begin() + 1);
+      }
+    }
+
+    std::size_t ReduceScatterCommon::getOutputCount()
+    {
+      return counts[group.rank().get()];
+    }
+  }
+}
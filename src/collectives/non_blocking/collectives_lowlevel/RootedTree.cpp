@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * RootedTree.cpp
+ *
+ */
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/RootedTree.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    std::size_t get_relative_rank(gaspi::group::Group const& group,
+                                  gaspi::group::Rank const& root)
+    {
+      return (group.size() + group.rank().get() - root.get()) % group.size();
+    }
+
+    gaspi::group::Rank get_group_rank(gaspi::group::Group const& group,
+                                      gaspi::group::Rank const& root,
+                                      std::size_t relative_rank)
+    {
+      return gaspi::group::Rank((relative_rank + root.get()) % group.size());
+    }
+
+    RootedTreeNode get_binomial_tree_node(std::size_t relative_rank,
+                                          std::size_t number_ranks)
+    {
+      // the parent clears the lowest set bit
+      RootedTreeNode node {relative_rank & (relative_rank - 1), number_ranks, {}};
+      for (auto mask = 1UL; mask < number_ranks; mask <<= 1)
+      {
+        if (relative_rank & mask)
+        {
+          node.subtree_end = std::min(relative_rank + mask, number_ranks);
+          break;
+        }
+        if (relative_rank + mask < number_ranks)
+        {
+          node.children.push_back(relative_rank + mask);
+        }
+      }
+      return node;
+    }
+
+    RootedTreeNode get_flat_tree_node(std::size_t relative_rank,
+                                      std::size_t number_ranks)
+    {
+      if (relative_rank != 0)
+      {
+        return {0, relative_rank + 1, {}};
+      }
+
+      RootedTreeNode node {0, number_ranks, std::vector<std::size_t>(number_ranks - 1)};
+      std::iota(node.children.begin(), node.children.end(), 1UL);
+      return node;
+    }
+  }
+}
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Tuning.cpp
+ *
+ */
+
+#include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/Tuning.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace gaspi
+{
+  namespace collectives
+  {
+    namespace
+    {
+      bool have_same_message_rules(SelectionTable const& first, SelectionTable const& second)
+      {
+        return std::equal(first.begin(), first.end(), second.begin(), second.end(),
+                          [](auto const& first_rule, auto const& second_rule)
+                          {
+                            return first_rule.max_message_bytes == second_rule.max_message_bytes &&
+                                   first_rule.algorithm == second_rule.algorithm;
+                          });
+      }
+    }
+
+    TuningTables parse_tuning_tables(std::string const& description)
+    {
+      TuningTables tables;
+      std::istringstream stream(description);
+      std::string line;
+      while (std::getline(stream, line))
+      {
+        std::istringstream line_stream(line.substr(0, line.find('#')));
+        std::string collective;
+        if (!(line_stream >> collective)) { continue; }
+
+        std::string const rules(std::istreambuf_iterator<char>(line_stream), {});
+        auto table = parse_selection_table(rules);
+        if (table.empty())
+        {
+          throw std::logic_error("parse_tuning_tables: No rules given for " + collective);
+        }
+        if (!tables.emplace(collective, std::move(table)).second)
+        {
+          throw std::logic_error("parse_tuning_tables: Duplicate collective " + collective);
+        }
+      }
+      return tables;
+    }
+
+    std::string to_string(TuningTables const& tables)
+    {
+      std::string description;
+      for (auto const& [collective, table] : tables)
+      {
+        description += collective + " " + to_string(table) + "\n";
+      }
+      return description;
+    }
+
+    TuningTables read_tuning_file(std::string const& path)
+    {
+      std::ifstream file(path);
+      if (!file)
+      {
+        throw std::logic_error("read_tuning_file: Cannot open " + path);
+      }
+      std::ostringstream contents;
+      contents << file.rdbuf();
+      return parse_tuning_tables(contents.str());
+    }
+
+    void write_tuning_file(std::string const& path, TuningTables const& tables)
+    {
+      std::ofstream file(path);
+      file << to_string(tables);
+      if (!file)
+      {
+        throw std::logic_error("write_tuning_file: Cannot write " + path);
+      }
+    }
+
+    std::string get_tuning_file()
+    {
+      auto const environment_file = std::getenv(tuning_file_variable);
+      if (environment_file != nullptr && *environment_file != '\0')
+      {
+        return environment_file;
+      }
+      return Runtime::configuration.get_tuning_file();
+    }
+
+    SelectionTable get_tuned_selection_table(std::string const& collective)
+    {
+      auto const path = get_tuning_file();
+      if (path.empty())
+      {
+        return {};
+      }
+      auto const tables = read_tuning_file(path);
+      auto const table = tables.find(collective);
+      return table == tables.end() ? SelectionTable{} : table->second;
+    }
+
+    SelectionTable build_selection_table(std::vector<TuningMeasurement> const& measurements)
+    {
+      // fastest (time, algorithm) per group size and message size
+      std::map<std::size_t, std::map<std::size_t, std::pair<double, std::string>>> fastest;
+      for (auto const& measurement : measurements)
+      {
+        auto& sizes = fastest[measurement.number_ranks];
+        auto const entry = sizes.find(measurement.message_bytes);
+        if (entry == sizes.end() || measurement.time < entry->second.first)
+        {
+          sizes[measurement.message_bytes] = {measurement.time, measurement.algorithm};
+        }
+      }
+
+      std::vector<SelectionTable> tables_per_group_size;
+      for (auto group_size = fastest.begin(); group_size != fastest.end(); ++group_size)
+      {
+        auto const max_number_ranks = std::next(group_size) == fastest.end() ?
+                                        SelectionRule::unbounded : group_size->first;
+        SelectionTable rules;
+        auto const& sizes = group_size->second;
+        for (auto message_size = sizes.begin(); message_size != sizes.end(); ++message_size)
+        {
+          auto const max_message_bytes = std::next(message_size) == sizes.end() ?
+                                           SelectionRule::unbounded : message_size->first;
+          auto const& algorithm = message_size->second.second;
+          if (!rules.empty() && rules.back().algorithm == algorithm)
+          {
+            rules.back().max_message_bytes = max_message_bytes;
+          }
+          else
+          {
+            rules.push_back({max_number_ranks, max_message_bytes, algorithm});
+          }
+        }
+
+        // group sizes with the same rules share them
+        if (!tables_per_group_size.empty() &&
+            have_same_message_rules(tables_per_group_size.back(), rules))
+        {
+          tables_per_group_size.back() = rules;
+        }
+        else
+        {
+          tables_per_group_size.push_back(rules);
+        }
+      }
+
+      SelectionTable table;
+      for (auto const& rules : tables_per_group_size)
+      {
+        table.insert(table.end(), rules.begin(), rules.end());
+      }
+      return table;
+    }
+  }
+}
@@ -53,7 +53,16 @@ PYBIND11_MODULE(pygpi_wrappers, m)
 
   py::enum_<gaspi::collectives::ReductionOp>(m, "ReductionOp")
      .value("SUM", gaspi::collectives::ReductionOp::SUM)
-     .value("PROD", gaspi::collectives::ReductionOp::PROD);
+     .value("PROD", gaspi::collectives::ReductionOp::PROD)
+     .value("MIN", gaspi::collectives::ReductionOp::MIN)
+     .value("MAX", gaspi::collectives::ReductionOp::MAX)
+     .value("MINLOC", gaspi::collectives::ReductionOp::MINLOC)
+     .value("MAXLOC", gaspi::collectives::ReductionOp::MAXLOC)
+     .value("BAND", gaspi::collectives::ReductionOp::BAND)
+     .value("BOR", gaspi::collectives::ReductionOp::BOR)
+     .value("BXOR", gaspi::collectives::ReductionOp::BXOR)
+     .value("LAND", gaspi::collectives::ReductionOp::LAND)
+     .value("LOR", gaspi::collectives::ReductionOp::LOR);
 
   m.def("generate_implemented_primitive_name", &generate_implemented_primitive_name,
         py::arg("collective"), py::arg("dtype"), py::arg("algorithm"));
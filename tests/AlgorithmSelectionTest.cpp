@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * AlgorithmSelectionTest.cpp
+ *
+ */
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AlgorithmSelection.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceAuto.hpp>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+
+namespace gaspi {
+  namespace collectives {
+
+    TEST(AlgorithmSelectionTest, parse_table)
+    {
+      auto const table = parse_selection_table(" 4:16384:recursivedoubling,\n*:*:ring ");
+      SelectionTable const expected
+        { {4, 16384, "recursivedoubling"},
+          {SelectionRule::unbounded, SelectionRule::unbounded, "ring"} };
+      ASSERT_EQ(table, expected);
+      ASSERT_EQ(parse_selection_table(to_string(table)), table);
+      ASSERT_TRUE(parse_selection_table("").empty());
+    }
+
+    TEST(AlgorithmSelectionTest, invalid_tables)
+    {
+      ASSERT_THROW(parse_selection_table("4:ring"), std::logic_error);
+      ASSERT_THROW(parse_selection_table("4:-1:ring"), std::logic_error);
+      ASSERT_THROW(parse_selection_table("x:*:ring"), std::logic_error);
+      ASSERT_THROW(parse_selection_table(":*:ring"), std::logic_error);
+    }
+
+    TEST(AlgorithmSelectionTest, first_matching_rule)
+    {
+      auto const table = parse_selection_table("2:*:a, *:100:b, *:1000:c");
+      ASSERT_EQ(select_algorithm_name(table, 1, 1000000), "a");
+      ASSERT_EQ(select_algorithm_name(table, 2, 0), "a");
+      ASSERT_EQ(select_algorithm_name(table, 3, 100), "b");
+      ASSERT_EQ(select_algorithm_name(table, 3, 101), "c");
+      ASSERT_THROW(select_algorithm_name(table, 3, 1001), std::logic_error);
+    }
+
+    TEST(AlgorithmSelectionTest, algorithm_names)
+    {
+      ASSERT_EQ(get_algorithm_by_name<AllreduceInfo>("ring"), AllreduceAlgorithm::RING);
+      ASSERT_EQ(get_algorithm_by_name<AllreduceInfo>("rabenseifner"),
+                AllreduceAlgorithm::RABENSEIFNER);
+      ASSERT_THROW(get_algorithm_by_name<AllreduceInfo>("unknown"), std::logic_error);
+    }
+
+    // every message size and group size has an algorithm
+    TEST(AlgorithmSelectionTest, builtin_allreduce_table)
+    {
+      auto const& table = get_builtin_allreduce_selection_table();
+      for (auto const number_ranks : {1UL, 4UL, 5UL, 16UL, 17UL, 1000UL})
+      {
+        for (auto const message_bytes : {0UL, 4096UL, 65536UL, 1UL << 30})
+        {
+          auto const& name = select_algorithm_name(table, number_ranks, message_bytes);
+          ASSERT_NE(get_algorithm_by_name<AllreduceInfo>(name), AllreduceAlgorithm::AUTO);
+        }
+      }
+    }
+  }
+}
@@ -1,9 +1,14 @@
 #include <gtest/gtest.h>
 
 #include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceAuto.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceCompressedRing.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceHierarchical.hpp>
 #include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceRing.hpp>
 #include <GaspiCxx/group/Group.hpp>
 
+#include <cmath>
+#include <cstdlib>
 #include <numeric>
 #include <stdexcept>
 #include <vector>
@@ -92,5 +97,269 @@ namespace gaspi {
 
       ASSERT_EQ(outputs, expected);
     }
+
+    TEST_F(AllreduceNonBlockingLowLevelTest, chunked_ring_allreduce)
+    {
+      using ElemType = int;
+      auto const num_elements = 1003UL;
+      auto const chunk_size_bytes = 7 * sizeof(ElemType);
+      AllreduceLowLevel<ElemType, AllreduceAlgorithm::RING> allreduce(
+        group_all, num_elements, ReductionOp::SUM, chunk_size_bytes);
+
+      std::vector<ElemType> inputs(num_elements);
+      std::vector<ElemType> expected(num_elements);
+      std::vector<ElemType> outputs(num_elements);
+
+      std::iota(inputs.begin(), inputs.end(), 1);
+
+      auto size = group_all.size();
+      std::transform(inputs.begin(), inputs.end(), expected.begin(),
+                    [&size](auto elem) { return elem * size; });
+
+      allreduce.waitForSetup();
+      for (auto i = 0; i < 2; ++i)
+      {
+        allreduce.copyIn(inputs.data());
+        allreduce.start();
+        allreduce.waitForCompletion();
+        allreduce.copyOut(outputs.data());
+
+        ASSERT_EQ(outputs, expected);
+      }
+    }
+
+    TEST_F(AllreduceNonBlockingLowLevelTest, double_buffered_ring_allreduce)
+    {
+      using ElemType = int;
+      auto const num_elements = 1003UL;
+      auto const chunk_size_bytes = 64 * sizeof(ElemType);
+      auto const double_buffering = true;
+      AllreduceLowLevel<ElemType, AllreduceAlgorithm::RING> allreduce(
+        group_all, num_elements, ReductionOp::SUM, chunk_size_bytes, double_buffering);
+
+      std::vector<ElemType> inputs(num_elements);
+      std::vector<ElemType> expected(num_elements);
+      std::vector<ElemType> outputs(num_elements);
+      auto const size = static_cast<ElemType>(group_all.size());
+
+      allreduce.waitForSetup();
+      for (auto run = 0; run < 5; ++run)
+      {
+        std::iota(inputs.begin(), inputs.end(), run);
+        std::transform(inputs.begin(), inputs.end(), expected.begin(),
+                      [&size](auto elem) { return elem * size; });
+
+        allreduce.copyIn(inputs.data());
+        allreduce.start();
+        allreduce.waitForCompletion();
+        allreduce.copyOut(outputs.data());
+
+        ASSERT_EQ(outputs, expected);
+      }
+    }
+
+    TEST_F(AllreduceNonBlockingLowLevelTest, hierarchical_allreduce_emulated_nodes)
+    {
+      using ElemType = int;
+      auto const num_elements = 1003UL;
+      auto const size = group_all.size();
+
+      std::vector<ElemType> inputs(num_elements);
+      std::vector<ElemType> expected(num_elements);
+      std::vector<ElemType> outputs(num_elements);
+
+      std::iota(inputs.begin(), inputs.end(), 1);
+      std::transform(inputs.begin(), inputs.end(), expected.begin(),
+                    [&size](auto elem) { return elem * size; });
+
+      // nodes of two consecutive ranks, and of interleaved ranks
+      std::vector<std::size_t> consecutive_node_ids(size);
+      std::vector<std::size_t> interleaved_node_ids(size);
+      for (auto i = 0UL; i < size; ++i)
+      {
+        consecutive_node_ids[i] = i / 2;
+        interleaved_node_ids[i] = i % 2;
+      }
+
+      for (auto const& node_ids : {consecutive_node_ids, interleaved_node_ids})
+      {
+        AllreduceLowLevel<ElemType, AllreduceAlgorithm::HIERARCHICAL> allreduce(
+          group_all, num_elements, ReductionOp::SUM, node_ids);
+
+        allreduce.waitForSetup();
+        for (auto i = 0; i < 2; ++i)
+        {
+          allreduce.copyIn(inputs.data());
+          allreduce.start();
+          allreduce.waitForCompletion();
+          allreduce.copyOut(outputs.data());
+
+          ASSERT_EQ(outputs, expected);
+        }
+      }
+    }
+
+    // selecting all elements is lossless
+    TEST_F(AllreduceNonBlockingLowLevelTest, compressed_ring_allreduce_top_k_all_elements)
+    {
+      using ElemType = float;
+      auto const num_elements = 1003UL;
+      auto const size = group_all.size();
+
+      std::vector<ElemType> inputs(num_elements);
+      std::vector<ElemType> expected(num_elements);
+      std::vector<ElemType> outputs(num_elements);
+      for (auto i = 0UL; i < num_elements; ++i)
+      {
+        inputs[i] = static_cast<ElemType>(i % 7) - 3;
+        expected[i] = inputs[i] * size;
+      }
+
+      AllreduceLowLevel<ElemType, AllreduceAlgorithm::COMPRESSED_RING> allreduce(
+        group_all, num_elements, ReductionOp::SUM, {CompressionMethod::TOP_K, 1.0, 0});
+
+      allreduce.waitForSetup();
+      for (auto i = 0; i < 3; ++i)
+      {
+        allreduce.copyIn(inputs.data());
+        allreduce.start();
+        allreduce.waitForCompletion();
+        allreduce.copyOut(outputs.data());
+
+        ASSERT_EQ(outputs, expected);
+      }
+    }
+
+    TEST_F(AllreduceNonBlockingLowLevelTest, compressed_ring_allreduce_quantized)
+    {
+      using ElemType = double;
+      auto const num_elements = 1003UL;
+      auto const size = group_all.size();
+
+      std::vector<ElemType> inputs(num_elements);
+      std::vector<ElemType> expected(num_elements);
+      std::vector<ElemType> outputs(num_elements);
+      for (auto i = 0UL; i < num_elements; ++i)
+      {
+        inputs[i] = std::sin(static_cast<ElemType>(i + group_all.rank().get()));
+      }
+      for (auto i = 0UL; i < num_elements; ++i)
+      {
+        for (auto r = 0UL; r < size; ++r)
+        {
+          expected[i] += std::sin(static_cast<ElemType>(i + r));
+        }
+      }
+
+      for (auto const& [method, levels] : {std::make_pair(CompressionMethod::QUANTIZATION_8BIT, 127.0),
+                                           std::make_pair(CompressionMethod::QUANTIZATION_4BIT, 7.0)})
+      {
+        AllreduceLowLevel<ElemType, AllreduceAlgorithm::COMPRESSED_RING> allreduce(
+          group_all, num_elements, ReductionOp::SUM, {method, 1.0, 64});
+        allreduce.waitForSetup();
+
+        allreduce.copyIn(inputs.data());
+        allreduce.start();
+        allreduce.waitForCompletion();
+        allreduce.copyOut(outputs.data());
+
+        // each of the (at most `size`) compressions of a partial sum
+        // has an error of at most its scale divided by the number of levels
+        for (auto i = 0UL; i < num_elements; ++i)
+        {
+          ASSERT_NEAR(outputs[i], expected[i], size * size / levels);
+        }
+        getRuntime().barrier();
+      }
+    }
+
+    // the errors of all compressions are sent in subsequent runs
+    TEST_F(AllreduceNonBlockingLowLevelTest, compressed_ring_allreduce_error_feedback)
+    {
+      using ElemType = float;
+      auto const size = group_all.size();
+      auto const num_elements = 8 * size;
+      auto const num_runs = 4 * num_elements;
+
+      std::vector<ElemType> inputs(num_elements);
+      std::vector<ElemType> zeros(num_elements, 0);
+      std::vector<ElemType> expected(num_elements);
+      std::vector<ElemType> outputs(num_elements);
+      std::vector<ElemType> accumulated_outputs(num_elements, 0);
+      for (auto i = 0UL; i < num_elements; ++i)
+      {
+        inputs[i] = static_cast<ElemType>((i + group_all.rank().get()) % 5);
+        for (auto r = 0UL; r < size; ++r)
+        {
+          expected[i] += static_cast<ElemType>((i + r) % 5);
+        }
+      }
+
+      // a single element of each block is sent per step
+      AllreduceLowLevel<ElemType, AllreduceAlgorithm::COMPRESSED_RING> allreduce(
+        group_all, num_elements, ReductionOp::SUM, {CompressionMethod::TOP_K, 0.01, 0});
+
+      allreduce.waitForSetup();
+      for (auto run = 0UL; run < num_runs; ++run)
+      {
+        allreduce.copyIn(run == 0 ? inputs.data() : zeros.data());
+        allreduce.start();
+        allreduce.waitForCompletion();
+        allreduce.copyOut(outputs.data());
+
+        for (auto i = 0UL; i < num_elements; ++i)
+        {
+          accumulated_outputs[i] += outputs[i];
+        }
+      }
+      ASSERT_EQ(accumulated_outputs, expected);
+    }
+
+    TEST_F(AllreduceNonBlockingLowLevelTest, auto_allreduce_configured_selection)
+    {
+      using ElemType = int;
+      auto const size = group_all.size();
+
+      Runtime::configuration.set_allreduce_selection("*:400:recursivedoubling, *:*:rabenseifner");
+      for (auto const& [num_elements, algorithm] :
+           {std::make_pair(100UL, AllreduceAlgorithm::RECURSIVE_DOUBLING),
+            std::make_pair(101UL, AllreduceAlgorithm::RABENSEIFNER)})
+      {
+        std::vector<ElemType> inputs(num_elements);
+        std::vector<ElemType> expected(num_elements);
+        std::vector<ElemType> outputs(num_elements);
+        std::iota(inputs.begin(), inputs.end(), 1);
+        std::transform(inputs.begin(), inputs.end(), expected.begin(),
+                      [&size](auto elem) { return elem * size; });
+
+        AllreduceLowLevel<ElemType, AllreduceAlgorithm::AUTO> allreduce(
+          group_all, num_elements, ReductionOp::SUM);
+        ASSERT_EQ(allreduce.getSelectedAlgorithm(), algorithm);
+
+        allreduce.waitForSetup();
+        allreduce.copyIn(inputs.data());
+        allreduce.start();
+        allreduce.waitForCompletion();
+        allreduce.copyOut(outputs.data());
+        ASSERT_EQ(outputs, expected);
+        getRuntime().barrier();
+      }
+      Runtime::configuration.set_allreduce_selection("");
+    }
+
+    // the environment variable takes precedence over the configuration
+    TEST_F(AllreduceNonBlockingLowLevelTest, auto_allreduce_environment_selection)
+    {
+      Runtime::configuration.set_allreduce_selection("*:*:rabenseifner");
+      setenv(allreduce_selection_variable, "*:*:ring", 1);
+
+      AllreduceLowLevel<int, AllreduceAlgorithm::AUTO> allreduce(
+        group_all, 10, ReductionOp::SUM);
+      ASSERT_EQ(allreduce.getSelectedAlgorithm(), AllreduceAlgorithm::RING);
+      allreduce.waitForSetup();
+
+      unsetenv(allreduce_selection_variable);
+      Runtime::configuration.set_allreduce_selection("");
+    }
   }
 }
@@ -30,6 +30,7 @@
 #include "parametrized_test_utilities.hpp"
 #include "collectives_utilities.hpp"
 
+#include <algorithm>
 #include <numeric>
 #include <stdexcept>
 #include <vector>
@@ -38,7 +39,10 @@ namespace gaspi {
   namespace collectives {
 
     std::vector<AllreduceAlgorithm> const allreduceAlgorithms{AllreduceAlgorithm::RECURSIVE_DOUBLING,
-                                                              AllreduceAlgorithm::RING};
+                                                              AllreduceAlgorithm::RING,
+                                                              AllreduceAlgorithm::RABENSEIFNER,
+                                                              AllreduceAlgorithm::HIERARCHICAL,
+                                                              AllreduceAlgorithm::AUTO};
 
     template<typename T>
     class AllreduceFactory
@@ -47,6 +51,13 @@ namespace gaspi {
         static auto factory(AllreduceAlgorithm alg,
                             gaspi::group::Group const& group, std::size_t num_elements,
                             ReductionOp red_op)
+        {
+          return factory_with_kernel(alg, group, num_elements, red_op);
+        }
+
+        static auto factory_with_kernel(AllreduceAlgorithm alg,
+                                        gaspi::group::Group const& group, std::size_t num_elements,
+                                        ReductionKernel<T> red_op)
         {
           std::unordered_map<AllreduceAlgorithm,
                             std::unique_ptr<Collective>> mapping;
@@ -56,6 +67,15 @@ namespace gaspi {
           mapping.insert(generate_map_element<AllreduceAlgorithm, Allreduce,
                                               T, AllreduceAlgorithm::RING>(
                                               group, num_elements, red_op));
+          mapping.insert(generate_map_element<AllreduceAlgorithm, Allreduce,
+                                              T, AllreduceAlgorithm::RABENSEIFNER>(
+                                              group, num_elements, red_op));
+          mapping.insert(generate_map_element<AllreduceAlgorithm, Allreduce,
+                                              T, AllreduceAlgorithm::HIERARCHICAL>(
+                                              group, num_elements, red_op));
+          mapping.insert(generate_map_element<AllreduceAlgorithm, Allreduce,
+                                              T, AllreduceAlgorithm::AUTO>(
+                                              group, num_elements, red_op));
           return std::move(mapping[alg]);
         }
     };
@@ -117,5 +137,213 @@ namespace gaspi {
                              testing::Combine(testing::ValuesIn(allreduceAlgorithms),
                                               testing::ValuesIn(dataSizes),
                                               testing::ValuesIn(elementTypes)));
+
+    class AllreduceReductionOpsTest : public CollectivesFixture,
+                                      public testing::WithParamInterface<AllreduceAlgorithm>
+    {
+      protected:
+        template<typename T>
+        std::vector<T> run_allreduce(ReductionKernel<T> reduction_op, std::vector<T> const& inputs)
+        {
+          auto allreduce = AllreduceFactory<T>::factory_with_kernel(GetParam(), group_all,
+                                                                     inputs.size(), reduction_op);
+          std::vector<T> outputs(inputs.size());
+          allreduce->start(inputs.data());
+          allreduce->waitForCompletion(outputs.data());
+          return outputs;
+        }
+
+        std::size_t const num_elements = 17;
+    };
+
+    TEST_P(AllreduceReductionOpsTest, min_max)
+    {
+      auto const rank = static_cast<int>(group_all.rank().get());
+      auto const size = static_cast<int>(group_all.size());
+      std::vector<int> inputs(num_elements, rank);
+
+      ASSERT_EQ(run_allreduce<int>(ReductionOp::MIN, inputs), std::vector<int>(num_elements, 0));
+      ASSERT_EQ(run_allreduce<int>(ReductionOp::MAX, inputs), std::vector<int>(num_elements, size - 1));
+    }
+
+    TEST_P(AllreduceReductionOpsTest, bitwise_and_logical)
+    {
+      auto const rank = group_all.rank().get();
+      auto const size = group_all.size();
+      std::vector<long> const bits(num_elements, 1L << rank);
+      std::vector<long> const is_first(num_elements, rank == 0 ? 1 : 0);
+
+      ASSERT_EQ(run_allreduce<long>(ReductionOp::BOR, bits),
+                std::vector<long>(num_elements, (1L << size) - 1));
+      ASSERT_EQ(run_allreduce<long>(ReductionOp::BXOR, bits),
+                std::vector<long>(num_elements, (1L << size) - 1));
+      ASSERT_EQ(run_allreduce<long>(ReductionOp::BAND, bits),
+                std::vector<long>(num_elements, size == 1 ? 1 : 0));
+      ASSERT_EQ(run_allreduce<long>(ReductionOp::LOR, is_first),
+                std::vector<long>(num_elements, 1));
+      ASSERT_EQ(run_allreduce<long>(ReductionOp::LAND, is_first),
+                std::vector<long>(num_elements, size == 1 ? 1 : 0));
+    }
+
+    TEST_P(AllreduceReductionOpsTest, min_max_location)
+    {
+      using T = ValueLocation<double>;
+      auto const rank = static_cast<int>(group_all.rank().get());
+      auto const size = static_cast<int>(group_all.size());
+      std::vector<T> const inputs(num_elements, T{static_cast<double>(rank % 2), rank});
+
+      ASSERT_EQ(run_allreduce<T>(ReductionOp::MINLOC, inputs),
+                std::vector<T>(num_elements, T{0.0, 0}));
+      ASSERT_EQ(run_allreduce<T>(ReductionOp::MAXLOC, inputs),
+                std::vector<T>(num_elements, T{size > 1 ? 1.0 : 0.0, size > 1 ? 1 : 0}));
+    }
+
+    struct Statistics
+    {
+      double min;
+      double max;
+      double sum;
+
+      bool operator==(Statistics const& other) const
+      {
+        return min == other.min && max == other.max && sum == other.sum;
+      }
+    };
+
+    TEST_P(AllreduceReductionOpsTest, user_defined_elementwise)
+    {
+      auto const rank = static_cast<double>(group_all.rank().get());
+      auto const size = static_cast<double>(group_all.size());
+      std::vector<Statistics> const inputs(num_elements, Statistics{rank, rank, rank});
+
+      auto const reduction = ReductionKernel<Statistics>::elementwise(
+        [](Statistics const& a, Statistics const& b)
+        {
+          return Statistics{std::min(a.min, b.min), std::max(a.max, b.max), a.sum + b.sum};
+        });
+
+      ASSERT_EQ(run_allreduce(reduction, inputs),
+                std::vector<Statistics>(num_elements,
+                                        Statistics{0, size - 1, size * (size - 1) / 2}));
+    }
+
+    TEST_P(AllreduceReductionOpsTest, user_defined_spanwise)
+    {
+      auto const rank = static_cast<int>(group_all.rank().get());
+      auto const size = static_cast<int>(group_all.size());
+      std::vector<int> const inputs(num_elements, rank + 1);
+
+      auto const reduction = ReductionKernel<int>::spanwise(
+        [](int* inouts, int const* inputs, std::size_t number_elements)
+        {
+          std::transform(inouts, inouts + number_elements, inputs, inouts,
+                         [](int a, int b) { return a + b; });
+        });
+
+      ASSERT_EQ(run_allreduce(reduction, inputs),
+                std::vector<int>(num_elements, size * (size + 1) / 2));
+    }
+
+    TEST_P(AllreduceReductionOpsTest, half_precision)
+    {
+      auto const rank = static_cast<float>(group_all.rank().get());
+      auto const size = static_cast<float>(group_all.size());
+      auto const expected = size * (size - 1) / 2 + 0.5f * size;
+
+      ASSERT_EQ(run_allreduce<float16>(ReductionOp::SUM,
+                                       std::vector<float16>(num_elements, float16(rank + 0.5f))),
+                std::vector<float16>(num_elements, float16(expected)));
+      ASSERT_EQ(run_allreduce<bfloat16>(ReductionOp::SUM,
+                                        std::vector<bfloat16>(num_elements, bfloat16(rank + 0.5f))),
+                std::vector<bfloat16>(num_elements, bfloat16(expected)));
+    }
+
+    TEST_P(AllreduceReductionOpsTest, unsupported_element_type)
+    {
+      ASSERT_THROW(AllreduceFactory<double>::factory(GetParam(), group_all,
+                                                     num_elements, ReductionOp::BAND),
+                   std::logic_error);
+    }
+
+    INSTANTIATE_TEST_SUITE_P(Coll, AllreduceReductionOpsTest,
+                             testing::ValuesIn(allreduceAlgorithms));
+
+    class AllreduceInPlaceTest : public CollectivesFixture,
+                                 public testing::WithParamInterface<AllreduceAlgorithm>
+    {
+      protected:
+        template<AllreduceAlgorithm Algorithm>
+        void run_in_place_allreduce(std::size_t num_elements)
+        {
+          using ElemType = long;
+          Allreduce<ElemType, Algorithm> allreduce(group_all, num_elements, ReductionOp::SUM);
+          auto const rank = static_cast<ElemType>(group_all.rank().get());
+          auto const size = static_cast<ElemType>(group_all.size());
+
+          for (auto run = 0; run < 3; ++run)
+          {
+            auto const data = allreduce.getInPlaceBuffer();
+            std::iota(data, data + num_elements, rank + run);
+
+            allreduce.start(data);
+            allreduce.waitForCompletion(data);
+
+            for (auto i = 0UL; i < num_elements; ++i)
+            {
+              auto const value = static_cast<ElemType>(i) + run;
+              ASSERT_EQ(data[i], size * value + size * (size - 1) / 2);
+            }
+          }
+        }
+
+        void run_in_place_allreduce(std::size_t num_elements)
+        {
+          switch (GetParam())
+          {
+            case AllreduceAlgorithm::RING:
+            {
+              run_in_place_allreduce<AllreduceAlgorithm::RING>(num_elements);
+              break;
+            }
+            case AllreduceAlgorithm::RECURSIVE_DOUBLING:
+            {
+              run_in_place_allreduce<AllreduceAlgorithm::RECURSIVE_DOUBLING>(num_elements);
+              break;
+            }
+            case AllreduceAlgorithm::RABENSEIFNER:
+            {
+              run_in_place_allreduce<AllreduceAlgorithm::RABENSEIFNER>(num_elements);
+              break;
+            }
+            case AllreduceAlgorithm::HIERARCHICAL:
+            {
+              run_in_place_allreduce<AllreduceAlgorithm::HIERARCHICAL>(num_elements);
+              break;
+            }
+            case AllreduceAlgorithm::AUTO:
+            {
+              run_in_place_allreduce<AllreduceAlgorithm::AUTO>(num_elements);
+              break;
+            }
+            default:
+            {
+              FAIL() << "Algorithm not covered by the in-place test";
+            }
+          }
+        }
+    };
+
+    TEST_P(AllreduceInPlaceTest, single_element)
+    {
+      run_in_place_allreduce(1);
+    }
+
+    TEST_P(AllreduceInPlaceTest, multiple_elements)
+    {
+      run_in_place_allreduce(1003);
+    }
+
+    INSTANTIATE_TEST_SUITE_P(Coll, AllreduceInPlaceTest,
+                             testing::ValuesIn(allreduceAlgorithms));
   }
 }
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * AlltoallvNonBlockingTest.cpp
+ *
+ */
+
+#include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/collectives/non_blocking/Alltoallv.hpp>
+#include <GaspiCxx/group/Group.hpp>
+
+#include "collectives_utilities.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+namespace gaspi {
+  namespace collectives {
+
+    template<typename T>
+    std::unique_ptr<Collective> make_alltoallv(AlltoallvAlgorithm algorithm,
+                                               gaspi::group::Group const& group,
+                                               std::vector<std::size_t> const& send_counts,
+                                               std::vector<std::size_t> const& recv_counts)
+    {
+      switch (algorithm)
+      {
+        case AlltoallvAlgorithm::PAIRWISE_EXCHANGE:
+        {
+          return std::make_unique<Alltoallv<T, AlltoallvAlgorithm::PAIRWISE_EXCHANGE>>(
+                   group, send_counts, recv_counts);
+        }
+        case AlltoallvAlgorithm::BRUCK:
+        {
+          return std::make_unique<Alltoallv<T, AlltoallvAlgorithm::BRUCK>>(
+                   group, send_counts, recv_counts);
+        }
+        case AlltoallvAlgorithm::AUTO:
+        {
+          return std::make_unique<Alltoallv<T, AlltoallvAlgorithm::AUTO>>(
+                   group, send_counts, recv_counts);
+        }
+      }
+      return nullptr;
+    }
+
+    // element `k` sent from rank `source` to rank `destination` in run `run`
+    long get_alltoall_element(std::size_t source, std::size_t destination,
+                              std::size_t k, int run)
+    {
+      return static_cast<long>(source * 1000000 + destination * 10000 + k) + run;
+    }
+
+    std::vector<long> get_alltoall_inputs(std::vector<std::size_t> const& send_counts,
+                                          gaspi::group::Rank const& rank, int run)
+    {
+      std::vector<long> inputs;
+      for (auto destination = 0UL; destination < send_counts.size(); ++destination)
+      {
+        for (auto k = 0UL; k < send_counts[destination]; ++k)
+        {
+          inputs.push_back(get_alltoall_element(rank.get(), destination, k, run));
+        }
+      }
+      return inputs;
+    }
+
+    std::vector<long> get_alltoall_expected(std::vector<std::size_t> const& recv_counts,
+                                            gaspi::group::Rank const& rank, int run)
+    {
+      std::vector<long> expected;
+      for (auto source = 0UL; source < recv_counts.size(); ++source)
+      {
+        for (auto k = 0UL; k < recv_counts[source]; ++k)
+        {
+          expected.push_back(get_alltoall_element(source, rank.get(), k, run));
+        }
+      }
+      return expected;
+    }
+
+    using AlltoallvTestCase = std::tuple<AlltoallvAlgorithm, std::size_t>;
+    class AlltoallvNonBlockingTest : public CollectivesFixture,
+                                     public testing::WithParamInterface<AlltoallvTestCase>
+    {
+      protected:
+        AlltoallvNonBlockingTest()
+        : algorithm(std::get<0>(GetParam())),
+          num_elements(std::get<1>(GetParam()))
+        { }
+
+        void exchange(std::vector<std::size_t> const& send_counts,
+                      std::vector<std::size_t> const& recv_counts)
+        {
+          auto const rank = group_all.rank();
+          auto alltoallv = make_alltoallv<long>(algorithm, group_all, send_counts, recv_counts);
+          ASSERT_EQ(alltoallv->getOutputCount(),
+                    std::accumulate(recv_counts.begin(), recv_counts.end(), 0UL));
+
+          for (auto run = 0; run < 3; ++run)
+          {
+            alltoallv->start(get_alltoall_inputs(send_counts, rank, run).data());
+            std::vector<long> outputs(alltoallv->getOutputCount(), -1);
+            alltoallv->waitForCompletion(outputs.data());
+            ASSERT_EQ(outputs, get_alltoall_expected(recv_counts, rank, run));
+          }
+        }
+
+        AlltoallvAlgorithm algorithm;
+        std::size_t num_elements;
+    };
+
+    TEST_P(AlltoallvNonBlockingTest, same_counts)
+    {
+      std::vector<std::size_t> const counts(group_all.size(), num_elements);
+      exchange(counts, counts);
+    }
+
+    // rank `r` sends `((r + j) % 3) * num_elements` elements to rank `j`
+    TEST_P(AlltoallvNonBlockingTest, various_counts)
+    {
+      auto const rank = group_all.rank().get();
+      std::vector<std::size_t> counts(group_all.size());
+      for (auto j = 0UL; j < counts.size(); ++j)
+      {
+        counts[j] = ((rank + j) % 3) * num_elements;
+      }
+      exchange(counts, counts);
+    }
+
+    INSTANTIATE_TEST_SUITE_P(Coll, AlltoallvNonBlockingTest,
+                             testing::Combine(testing::ValuesIn(AlltoallvInfo::implemented),
+                                              testing::Values(0UL, 1UL, 5UL, 1003UL)));
+
+    class AlltoallvNonBlockingTestHighLevel : public CollectivesFixture
+    { };
+
+    TEST_F(AlltoallvNonBlockingTestHighLevel, alltoall_vectors)
+    {
+      auto const count = 3UL;
+      auto const rank = group_all.rank();
+      Alltoall<long, AlltoallvAlgorithm::BRUCK> alltoall(group_all, count);
+      std::vector<std::size_t> const counts(group_all.size(), count);
+      ASSERT_EQ(alltoall.get_send_counts(), counts);
+      ASSERT_EQ(alltoall.get_recv_counts(), counts);
+
+      alltoall.start(get_alltoall_inputs(counts, rank, 0));
+      std::vector<long> outputs(alltoall.getOutputCount());
+      alltoall.waitForCompletion(outputs);
+      ASSERT_EQ(outputs, get_alltoall_expected(counts, rank, 0));
+    }
+
+    // rank `r` sends `j + 1` elements to rank `j`, i.e., receives `r + 1`
+    // elements from each rank
+    TEST_F(AlltoallvNonBlockingTestHighLevel, alltoallv_exchanged_counts)
+    {
+      auto const rank = group_all.rank();
+      std::vector<std::size_t> send_counts(group_all.size());
+      std::iota(send_counts.begin(), send_counts.end(), 1UL);
+      std::vector<std::size_t> const recv_counts(group_all.size(), rank.get() + 1);
+
+      Alltoallv<long, AlltoallvAlgorithm::PAIRWISE_EXCHANGE> alltoallv(group_all, send_counts);
+      ASSERT_EQ(alltoallv.get_recv_counts(), recv_counts);
+
+      alltoallv.start(get_alltoall_inputs(send_counts, rank, 0));
+      std::vector<long> outputs(alltoallv.getOutputCount());
+      alltoallv.waitForCompletion(outputs);
+      ASSERT_EQ(outputs, get_alltoall_expected(recv_counts, rank, 0));
+    }
+
+    TEST_F(AlltoallvNonBlockingTestHighLevel, invalid_counts)
+    {
+      std::vector<std::size_t> const counts(group_all.size() + 1, 1);
+      ASSERT_THROW((Alltoallv<int, AlltoallvAlgorithm::PAIRWISE_EXCHANGE>(
+                      group_all, counts, counts)), std::logic_error);
+    }
+
+    TEST(AlltoallvNonBlockingTestSelection, builtin_alltoallv_table)
+    {
+      auto const& table = get_builtin_alltoallv_selection_table();
+      ASSERT_EQ(get_algorithm_by_name<AlltoallvInfo>(select_algorithm_name(table, 8, 1024)),
+                AlltoallvAlgorithm::BRUCK);
+      ASSERT_EQ(get_algorithm_by_name<AlltoallvInfo>(select_algorithm_name(table, 8, 1UL << 20)),
+                AlltoallvAlgorithm::PAIRWISE_EXCHANGE);
+    }
+  }
+}
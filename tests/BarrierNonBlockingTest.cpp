@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * BarrierNonBlockingTest.cpp
+ *
+ */
+
+#include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/collectives/non_blocking/Barrier.hpp>
+#include <GaspiCxx/group/Group.hpp>
+
+#include "collectives_utilities.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <numeric>
+#include <vector>
+
+namespace gaspi {
+  namespace collectives {
+
+    class BarrierNonBlockingTest : public CollectivesFixture,
+                                   public testing::WithParamInterface<BarrierAlgorithm>
+    {
+      protected:
+        BarrierNonBlockingTest()
+        : algorithm(GetParam())
+        { }
+
+        BarrierAlgorithm algorithm;
+    };
+
+    namespace
+    {
+      std::unique_ptr<Barrier<BarrierAlgorithm::DISSEMINATION>>
+      make_barrier(BarrierAlgorithm algorithm, gaspi::group::Group const& group)
+      {
+        switch (algorithm)
+        {
+          case BarrierAlgorithm::DISSEMINATION:
+          {
+            return std::make_unique<Barrier<BarrierAlgorithm::DISSEMINATION>>(group);
+          }
+        }
+        return nullptr;
+      }
+    }
+
+    TEST_P(BarrierNonBlockingTest, multiple_runs)
+    {
+      auto barrier = make_barrier(algorithm, group_all);
+      for (auto run = 0; run < 10; ++run)
+      {
+        barrier->start();
+        barrier->waitForCompletion();
+      }
+    }
+
+    TEST_P(BarrierNonBlockingTest, test_until_completion)
+    {
+      auto barrier = make_barrier(algorithm, group_all);
+      for (auto run = 0; run < 5; ++run)
+      {
+        barrier->start();
+        while (!barrier->test())
+        { }
+        // already completed
+        barrier->waitForCompletion();
+      }
+    }
+
+    // the barrier cannot complete before the last rank has entered it
+    TEST_P(BarrierNonBlockingTest, waits_for_last_rank)
+    {
+      gaspi::group::Rank const last_rank(group_all.size() - 1);
+      auto barrier = make_barrier(algorithm, group_all);
+
+      if (group_all.rank() == last_rank)
+      {
+        getRuntime().barrier();
+        barrier->start();
+      }
+      else
+      {
+        barrier->start();
+        ASSERT_FALSE(barrier->test());
+        getRuntime().barrier();
+      }
+      barrier->waitForCompletion();
+    }
+
+    TEST_P(BarrierNonBlockingTest, overlapping_groups)
+    {
+      auto const number_ranks = group_all.size();
+      auto const rank = group_all.rank().get();
+
+      std::vector<std::unique_ptr<Barrier<BarrierAlgorithm::DISSEMINATION>>> barriers;
+      for (auto const group_size : {number_ranks / 2, number_ranks - 1, number_ranks})
+      {
+        if (rank >= group_size) { continue; }
+
+        std::vector<gaspi::group::GlobalRank> global_ranks(group_size);
+        std::iota(global_ranks.begin(), global_ranks.end(), 0);
+        barriers.push_back(make_barrier(algorithm, gaspi::group::Group(global_ranks)));
+      }
+
+      for (auto run = 0; run < 5; ++run)
+      {
+        for (auto& barrier : barriers)
+        {
+          barrier->start();
+        }
+        for (auto& barrier : barriers)
+        {
+          barrier->waitForCompletion();
+        }
+      }
+    }
+
+    INSTANTIATE_TEST_SUITE_P(Coll, BarrierNonBlockingTest,
+                             testing::ValuesIn(BarrierInfo::implemented));
+  }
+}
@@ -25,6 +25,9 @@
 #include <GaspiCxx/collectives/non_blocking/Broadcast.hpp>
 #include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/BroadcastSendToAll.hpp>
 #include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/BroadcastBasicLinear.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/BroadcastBinomialTree.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/BroadcastPipelinedChain.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/BroadcastScatterAllgather.hpp>
 #include <GaspiCxx/group/Group.hpp>
 
 #include "parametrized_test_utilities.hpp"
@@ -40,7 +43,10 @@ namespace gaspi {
 
     std::mt19937 generator(42);
     std::vector<BroadcastAlgorithm> const broadcastAlgorithms{BroadcastAlgorithm::BASIC_LINEAR,
-                                                              BroadcastAlgorithm::SEND_TO_ALL};
+                                                              BroadcastAlgorithm::SEND_TO_ALL,
+                                                              BroadcastAlgorithm::BINOMIAL_TREE,
+                                                              BroadcastAlgorithm::PIPELINED_CHAIN,
+                                                              BroadcastAlgorithm::SCATTER_ALLGATHER};
 
     template<typename T>
     class BroadcastFactory
@@ -58,6 +64,15 @@ namespace gaspi {
           mapping.insert(generate_map_element<BroadcastAlgorithm, Broadcast,
                                               T, BroadcastAlgorithm::BASIC_LINEAR>(
                                                         group, num_elements, root));
+          mapping.insert(generate_map_element<BroadcastAlgorithm, Broadcast,
+                                              T, BroadcastAlgorithm::BINOMIAL_TREE>(
+                                                        group, num_elements, root));
+          mapping.insert(generate_map_element<BroadcastAlgorithm, Broadcast,
+                                              T, BroadcastAlgorithm::PIPELINED_CHAIN>(
+                                                        group, num_elements, root));
+          mapping.insert(generate_map_element<BroadcastAlgorithm, Broadcast,
+                                              T, BroadcastAlgorithm::SCATTER_ALLGATHER>(
+                                                        group, num_elements, root));
           return std::move(mapping[alg]);
         }
     };
@@ -123,6 +138,90 @@ namespace gaspi {
       ASSERT_EQ(*outputs, *expected);
     }
 
+    // runs are not separated by any synchronization
+    TEST_P(BroadcastTest, consecutive_bcasts)
+    {
+      auto broadcast = make_bcast();
+      auto inputs = make_data();
+      auto outputs = make_data();
+      auto expected = make_data();
+
+      inputs->fill(42.22);
+      expected->fill(42.22);
+
+      for (auto i = 0; i < 5; ++i)
+      {
+        outputs->fill(0);
+        if (group_all.rank() == root)
+        {
+          broadcast->start(inputs->get_data());
+        }
+        else
+        {
+          broadcast->start();
+        }
+        broadcast->waitForCompletion(outputs->get_data());
+
+        ASSERT_EQ(*outputs, *expected);
+      }
+    }
+
+    class BroadcastTestPipelinedChain : public CollectivesFixture
+    { };
+
+    // chunks of different sizes pipelined through the chain,
+    // with different data in each run
+    TEST_F(BroadcastTestPipelinedChain, multiple_chunks)
+    {
+      auto const num_elements = 100UL;
+      gaspi::group::Rank const root(group_all.size() - 1);
+      BroadcastLowLevel<int, BroadcastAlgorithm::PIPELINED_CHAIN> broadcast(
+        group_all, num_elements, root, 7 * sizeof(int));
+
+      broadcast.waitForSetup();
+      for (auto run = 0; run < 3; ++run)
+      {
+        std::vector<int> expected(num_elements);
+        std::iota(expected.begin(), expected.end(), run);
+        std::vector<int> outputs(num_elements, 0);
+
+        broadcast.copyIn(group_all.rank() == root ? expected.data() : CollectiveLowLevel::NO_DATA);
+        broadcast.start();
+        broadcast.waitForCompletion();
+        broadcast.copyOut(outputs.data());
+        ASSERT_EQ(outputs, expected);
+      }
+    }
+
+    class BroadcastTestScatterAllgather : public CollectivesFixture
+    { };
+
+    // parts of different sizes (some of them empty), with different data
+    // in each run
+    TEST_F(BroadcastTestScatterAllgather, uneven_parts)
+    {
+      gaspi::group::Rank const root(group_all.size() / 2);
+      for (auto const num_elements : {group_all.size() / 2, 3 * group_all.size() + 2})
+      {
+        BroadcastLowLevel<long, BroadcastAlgorithm::SCATTER_ALLGATHER> broadcast(
+          group_all, num_elements, root);
+
+        broadcast.waitForSetup();
+        for (auto run = 0; run < 3; ++run)
+        {
+          std::vector<long> expected(num_elements);
+          std::iota(expected.begin(), expected.end(), 10 * run);
+          std::vector<long> outputs(num_elements, 0);
+
+          broadcast.copyIn(group_all.rank() == root ? expected.data() : CollectiveLowLevel::NO_DATA);
+          broadcast.start();
+          broadcast.waitForCompletion();
+          broadcast.copyOut(outputs.data());
+          ASSERT_EQ(outputs, expected);
+        }
+      }
+    }
+
     std::vector<ElementType> const elementTypes{"int", "float", "double"};
     std::vector<DataSize> const dataSizes{0, 1, 5, 32, 1003};
     INSTANTIATE_TEST_SUITE_P(Coll, BroadcastTest,
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * CompressionTest.cpp
+ *
+ */
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/Compression.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace gaspi {
+  namespace collectives {
+
+    template<typename T>
+    class CompressionTest : public ::testing::Test
+    {
+      protected:
+        std::uint32_t const seed = 42;
+
+        std::vector<T> get_values(std::size_t number_elements)
+        {
+          std::vector<T> values(number_elements);
+          for (auto i = 0UL; i < number_elements; ++i)
+          {
+            values[i] = static_cast<T>((i * 37) % 101) / T(10) - T(5);
+          }
+          return values;
+        }
+
+        // compressed values and errors add up to the original values
+        void check_quantization(CompressionMethod method, T levels)
+        {
+          auto const number_elements = 1003UL;
+          auto const block_size = 64UL;
+          Compressor<T> compressor({method, 1.0, block_size}, number_elements, seed);
+
+          auto const values = get_values(number_elements);
+          std::vector<T> errors(number_elements, T(0));
+          std::vector<T> decompressed(number_elements);
+          std::vector<char> payload(compressor.get_max_payload_size());
+
+          auto const size = compressor.compress(values.data(), errors.data(), payload.data());
+          ASSERT_EQ(size, compressor.get_max_payload_size());
+          ASSERT_EQ(size, compressor.get_payload_size(payload.data()));
+          compressor.decompress(payload.data(), decompressed.data());
+
+          for (auto i = 0UL; i < number_elements; ++i)
+          {
+            auto const begin = i - i % block_size;
+            T scale(0);
+            for (auto j = begin; j < std::min(begin + block_size, number_elements); ++j)
+            {
+              scale = std::max(scale, std::abs(values[j]));
+            }
+            ASSERT_LE(std::abs(decompressed[i] - values[i]), scale / levels * T(1.0001));
+            ASSERT_NEAR(decompressed[i] + errors[i], values[i], 1e-5);
+          }
+        }
+    };
+
+    using ElementTypes = ::testing::Types<float, double>;
+    TYPED_TEST_SUITE(CompressionTest, ElementTypes);
+
+    TYPED_TEST(CompressionTest, top_k_selects_largest_magnitudes)
+    {
+      using T = TypeParam;
+      std::vector<T> const values{1, -7, 2, 0.5, 6, -3, 0, 5, -0.25, 4};
+      std::vector<T> const expected{0, -7, 0, 0, 6, 0, 0, 5, 0, 0};
+      std::vector<T> const expected_errors{1, 0, 2, 0.5, 0, -3, 0, 0, -0.25, 4};
+
+      Compressor<T> compressor({CompressionMethod::TOP_K, 0.25, 0}, values.size(), this->seed);
+      std::vector<T> errors(values.size(), T(0));
+      std::vector<T> decompressed(values.size(), T(1));
+      std::vector<char> payload(compressor.get_max_payload_size());
+
+      auto const size = compressor.compress(values.data(), errors.data(), payload.data());
+      ASSERT_EQ(size, sizeof(std::uint32_t) + 3 * (sizeof(std::uint32_t) + sizeof(T)));
+      ASSERT_EQ(size, compressor.get_payload_size(payload.data()));
+
+      compressor.decompress(payload.data(), decompressed.data());
+      ASSERT_EQ(decompressed, expected);
+      ASSERT_EQ(errors, expected_errors);
+    }
+
+    TYPED_TEST(CompressionTest, top_k_skips_zeros)
+    {
+      using T = TypeParam;
+      std::vector<T> const values{0, 0, 3, 0, 0, 0};
+
+      Compressor<T> compressor({CompressionMethod::TOP_K, 0.5, 0}, values.size(), this->seed);
+      std::vector<T> errors(values.size(), T(0));
+      std::vector<T> decompressed(values.size(), T(1));
+      std::vector<char> payload(compressor.get_max_payload_size());
+
+      auto const size = compressor.compress(values.data(), errors.data(), payload.data());
+      ASSERT_EQ(size, sizeof(std::uint32_t) + sizeof(std::uint32_t) + sizeof(T));
+
+      compressor.decompress(payload.data(), decompressed.data());
+      ASSERT_EQ(decompressed, values);
+      ASSERT_EQ(errors, std::vector<T>(values.size(), T(0)));
+    }
+
+    TYPED_TEST(CompressionTest, quantization_8bit)
+    {
+      this->check_quantization(CompressionMethod::QUANTIZATION_8BIT, 127);
+    }
+
+    TYPED_TEST(CompressionTest, quantization_4bit)
+    {
+      this->check_quantization(CompressionMethod::QUANTIZATION_4BIT, 7);
+    }
+
+    // stochastic rounding does not introduce a bias
+    TYPED_TEST(CompressionTest, quantization_unbiased)
+    {
+      using T = TypeParam;
+      std::vector<T> const values{T(0.3), T(-1)};
+      auto const repetitions = 10000;
+
+      Compressor<T> compressor({CompressionMethod::QUANTIZATION_4BIT, 1.0, 2},
+                               values.size(), this->seed);
+      std::vector<T> errors(values.size(), T(0));
+      std::vector<T> decompressed(values.size());
+      std::vector<char> payload(compressor.get_max_payload_size());
+
+      double sum = 0;
+      for (auto i = 0; i < repetitions; ++i)
+      {
+        compressor.compress(values.data(), errors.data(), payload.data());
+        compressor.decompress(payload.data(), decompressed.data());
+        sum += decompressed[0];
+        ASSERT_EQ(decompressed[1], values[1]);
+      }
+      ASSERT_NEAR(sum / repetitions, values[0], 0.005);
+    }
+
+    TYPED_TEST(CompressionTest, invalid_settings)
+    {
+      using T = TypeParam;
+      ASSERT_THROW(Compressor<T>({CompressionMethod::TOP_K, 0.0, 0}, 10, this->seed),
+                   std::logic_error);
+      ASSERT_THROW(Compressor<T>({CompressionMethod::TOP_K, 1.5, 0}, 10, this->seed),
+                   std::logic_error);
+      ASSERT_THROW(Compressor<T>({CompressionMethod::QUANTIZATION_8BIT, 1.0, 0}, 10, this->seed),
+                   std::logic_error);
+    }
+  }
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * FusedAllreduceTest.cpp
+ *
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/collectives/non_blocking/FusedAllreduce.hpp>
+#include <GaspiCxx/group/Group.hpp>
+
+#include "collectives_utilities.hpp"
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace gaspi {
+  namespace collectives {
+
+    class FusedAllreduceTest : public CollectivesFixture
+    {
+      protected:
+        using ElemType = float;
+        using Fusion = FusedAllreduce<ElemType, AllreduceAlgorithm::RING>;
+
+        FusedAllreduceTest()
+        : tensor_counts{3, 100, 1, 0, 57, 2000, 14},
+          inputs(), outputs(), expected()
+        {
+          auto const rank = static_cast<ElemType>(group_all.rank().get());
+          auto const size = static_cast<ElemType>(group_all.size());
+          for (auto const& count : tensor_counts)
+          {
+            inputs.emplace_back(count);
+            std::iota(inputs.back().begin(), inputs.back().end(), rank);
+            outputs.emplace_back(count);
+            expected.emplace_back(count);
+            std::iota(expected.back().begin(), expected.back().end(), 0.0f);
+            for (auto& value : expected.back())
+            {
+              value = value * size + size * (size - 1) / 2;
+            }
+          }
+        }
+
+        std::vector<Fusion::Input> get_inputs() const
+        {
+          std::vector<Fusion::Input> tensors;
+          for (auto const& tensor : inputs)
+          {
+            tensors.emplace_back(tensor.data(), tensor.size());
+          }
+          return tensors;
+        }
+
+        std::vector<Fusion::Output> get_outputs()
+        {
+          std::vector<Fusion::Output> tensors;
+          for (auto& tensor : outputs)
+          {
+            tensors.emplace_back(tensor.data(), tensor.size());
+          }
+          return tensors;
+        }
+
+        std::vector<std::size_t> const tensor_counts;
+        std::vector<std::vector<ElemType>> inputs;
+        std::vector<std::vector<ElemType>> outputs;
+        std::vector<std::vector<ElemType>> expected;
+    };
+
+    TEST_F(FusedAllreduceTest, single_bucket)
+    {
+      Fusion allreduce(group_all, tensor_counts, ReductionOp::SUM);
+      ASSERT_EQ(allreduce.getNumberBuckets(), 1UL);
+
+      allreduce.start(get_inputs());
+      allreduce.waitForCompletion(get_outputs());
+      ASSERT_EQ(outputs, expected);
+    }
+
+    TEST_F(FusedAllreduceTest, multiple_buckets)
+    {
+      auto const bucket_size_bytes = 128 * sizeof(ElemType);
+      Fusion allreduce(group_all, tensor_counts, ReductionOp::SUM, bucket_size_bytes);
+      // {3, 100, 1, 0}, {57}, {2000}, {14}
+      ASSERT_EQ(allreduce.getNumberBuckets(), 4UL);
+
+      for (auto run = 0; run < 2; ++run)
+      {
+        allreduce.start(get_inputs());
+        allreduce.waitForCompletion(get_outputs());
+        ASSERT_EQ(outputs, expected);
+      }
+    }
+
+    TEST_F(FusedAllreduceTest, mismatching_tensors)
+    {
+      Fusion allreduce(group_all, tensor_counts, ReductionOp::SUM);
+      auto tensors = get_inputs();
+      tensors.back().second++;
+      ASSERT_THROW(allreduce.start(tensors), std::logic_error);
+
+      tensors.pop_back();
+      ASSERT_THROW(allreduce.start(tensors), std::logic_error);
+    }
+  }
+}
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * GatherTest.cpp
+ *
+ */
+
+#include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/collectives/non_blocking/Gatherv.hpp>
+#include <GaspiCxx/group/Group.hpp>
+
+#include "collectives_utilities.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+namespace gaspi {
+  namespace collectives {
+
+    template<typename T>
+    std::unique_ptr<RootedReceiveCollective> make_gatherv(GathervAlgorithm algorithm,
+                                                          gaspi::group::Group const& group,
+                                                          std::vector<std::size_t> const& counts,
+                                                          gaspi::group::Rank const& root)
+    {
+      switch (algorithm)
+      {
+        case GathervAlgorithm::BINOMIAL_TREE:
+        {
+          return std::make_unique<Gatherv<T, GathervAlgorithm::BINOMIAL_TREE>>(
+                   group, counts, root);
+        }
+        case GathervAlgorithm::DIRECT:
+        {
+          return std::make_unique<Gatherv<T, GathervAlgorithm::DIRECT>>(
+                   group, counts, root);
+        }
+      }
+      return nullptr;
+    }
+
+    // element `i` of rank `r` is `1000 * r + i`
+    std::vector<int> get_gather_inputs(gaspi::group::Rank const& rank, std::size_t count)
+    {
+      std::vector<int> inputs(count);
+      std::iota(inputs.begin(), inputs.end(), 1000 * rank.get());
+      return inputs;
+    }
+
+    std::vector<int> get_gather_expected(std::vector<std::size_t> const& counts)
+    {
+      std::vector<int> expected;
+      for (auto i = 0UL; i < counts.size(); ++i)
+      {
+        auto const inputs = get_gather_inputs(gaspi::group::Rank(i), counts[i]);
+        expected.insert(expected.end(), inputs.begin(), inputs.end());
+      }
+      return expected;
+    }
+
+    using GatherTestCase = std::tuple<GathervAlgorithm, std::size_t>;
+    class GatherTest : public CollectivesFixture,
+                       public testing::WithParamInterface<GatherTestCase>
+    {
+      protected:
+        GatherTest()
+        : algorithm(std::get<0>(GetParam())),
+          num_elements(std::get<1>(GetParam()))
+        { }
+
+        void gather_to_each_root(std::vector<std::size_t> const& counts)
+        {
+          auto const rank = group_all.rank();
+          auto const inputs = get_gather_inputs(rank, counts[rank.get()]);
+          auto const expected = get_gather_expected(counts);
+
+          for (auto root = 0UL; root < group_all.size(); ++root)
+          {
+            auto gatherv = make_gatherv<int>(algorithm, group_all, counts,
+                                             gaspi::group::Rank(root));
+            for (auto run = 0; run < 2; ++run)
+            {
+              gatherv->start(inputs.data());
+              if (rank == gaspi::group::Rank(root))
+              {
+                ASSERT_EQ(gatherv->getOutputCount(), expected.size());
+                std::vector<int> outputs(expected.size(), -1);
+                gatherv->waitForCompletion(outputs.data());
+                ASSERT_EQ(outputs, expected);
+              }
+              else
+              {
+                ASSERT_EQ(gatherv->getOutputCount(), 0UL);
+                gatherv->waitForCompletion();
+              }
+            }
+            getRuntime().barrier();
+          }
+        }
+
+        GathervAlgorithm algorithm;
+        std::size_t num_elements;
+    };
+
+    TEST_P(GatherTest, same_counts)
+    {
+      gather_to_each_root(std::vector<std::size_t>(group_all.size(), num_elements));
+    }
+
+    // rank `r` contributes `(r % 3) * num_elements` elements
+    TEST_P(GatherTest, various_counts)
+    {
+      std::vector<std::size_t> counts(group_all.size());
+      for (auto i = 0UL; i < counts.size(); ++i)
+      {
+        counts[i] = (i % 3) * num_elements;
+      }
+      gather_to_each_root(counts);
+    }
+
+    TEST_P(GatherTest, wrong_rank_calls)
+    {
+      gaspi::group::Rank const root(0);
+      std::vector<std::size_t> const counts(group_all.size(), num_elements);
+      auto gatherv = make_gatherv<int>(algorithm, group_all, counts, root);
+      auto const inputs = get_gather_inputs(group_all.rank(), num_elements);
+      std::vector<int> outputs(num_elements * group_all.size());
+
+      gatherv->start(inputs.data());
+      if (group_all.rank() == root)
+      {
+        ASSERT_THROW(gatherv->waitForCompletion(), std::logic_error);
+        gatherv->waitForCompletion(outputs.data());
+        ASSERT_EQ(outputs, get_gather_expected(counts));
+      }
+      else
+      {
+        ASSERT_THROW(gatherv->waitForCompletion(outputs.data()), std::logic_error);
+        gatherv->waitForCompletion();
+      }
+    }
+
+    INSTANTIATE_TEST_SUITE_P(Coll, GatherTest,
+                             testing::Combine(testing::ValuesIn(GathervInfo::implemented),
+                                              testing::Values(0UL, 1UL, 5UL, 1003UL)));
+
+    class GatherTestHighLevel : public CollectivesFixture
+    { };
+
+    TEST_F(GatherTestHighLevel, gather_vectors)
+    {
+      auto const count = 4UL;
+      gaspi::group::Rank const root(group_all.size() - 1);
+      Gather<int, GathervAlgorithm::BINOMIAL_TREE> gather(group_all, count, root);
+      std::vector<std::size_t> const counts(group_all.size(), count);
+      ASSERT_EQ(gather.get_counts(), counts);
+
+      gather.start(get_gather_inputs(group_all.rank(), count));
+      if (group_all.rank() == root)
+      {
+        std::vector<int> outputs(gather.getOutputCount());
+        gather.waitForCompletion(outputs);
+        ASSERT_EQ(outputs, get_gather_expected(counts));
+      }
+      else
+      {
+        gather.waitForCompletion();
+      }
+    }
+
+    // counts exchanged at construction
+    TEST_F(GatherTestHighLevel, gatherv_exchanged_counts)
+    {
+      auto const count = group_all.rank().get() + 1;
+      gaspi::group::Rank const root(0);
+      Gatherv<int, GathervAlgorithm::DIRECT> gatherv(group_all, count, root);
+      std::vector<std::size_t> counts(group_all.size());
+      std::iota(counts.begin(), counts.end(), 1UL);
+      ASSERT_EQ(gatherv.get_counts(), counts);
+
+      gatherv.start(get_gather_inputs(group_all.rank(), count));
+      if (group_all.rank() == root)
+      {
+        std::vector<int> outputs(gatherv.getOutputCount());
+        gatherv.waitForCompletion(outputs);
+        ASSERT_EQ(outputs, get_gather_expected(counts));
+      }
+      else
+      {
+        gatherv.waitForCompletion();
+      }
+    }
+  }
+}
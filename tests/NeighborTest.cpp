@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * NeighborTest.cpp
+ *
+ */
+
+#include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/collectives/non_blocking/NeighborAlltoallv.hpp>
+#include <GaspiCxx/group/Group.hpp>
+
+#include "collectives_utilities.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace gaspi {
+  namespace collectives {
+
+    template<typename T>
+    std::unique_ptr<Collective> make_neighbor_alltoallv(NeighborAlgorithm algorithm,
+                                                        gaspi::group::Group const& group,
+                                                        NeighborGraph const& graph,
+                                                        std::vector<std::size_t> const& send_counts,
+                                                        std::vector<std::size_t> const& recv_counts)
+    {
+      switch (algorithm)
+      {
+        case NeighborAlgorithm::DIRECT:
+        {
+          return std::make_unique<NeighborAlltoallv<T, NeighborAlgorithm::DIRECT>>(
+                   group, graph, send_counts, recv_counts);
+        }
+      }
+      return nullptr;
+    }
+
+    template<typename T>
+    std::unique_ptr<Collective> make_neighbor_allgather(NeighborAlgorithm algorithm,
+                                                        gaspi::group::Group const& group,
+                                                        NeighborGraph const& graph,
+                                                        std::size_t count)
+    {
+      switch (algorithm)
+      {
+        case NeighborAlgorithm::DIRECT:
+        {
+          return std::make_unique<NeighborAllgather<T, NeighborAlgorithm::DIRECT>>(
+                   group, graph, count);
+        }
+      }
+      return nullptr;
+    }
+
+    class NeighborTest : public CollectivesFixture,
+                         public testing::WithParamInterface<NeighborAlgorithm>
+    {
+      protected:
+        NeighborTest()
+        : algorithm(GetParam()),
+          number_ranks(group_all.size()),
+          rank(group_all.rank().get())
+        { }
+
+        NeighborAlgorithm algorithm;
+        std::size_t number_ranks;
+        std::size_t rank;
+
+        gaspi::group::Rank left() const
+        {
+          return gaspi::group::Rank((rank + number_ranks - 1) % number_ranks);
+        }
+        gaspi::group::Rank right() const
+        {
+          return gaspi::group::Rank((rank + 1) % number_ranks);
+        }
+    };
+
+    // halo exchange on a periodic 1D domain (the neighbors coincide
+    // for one or two ranks)
+    TEST_P(NeighborTest, allgather_periodic_halo)
+    {
+      auto const count = 5UL;
+      auto const graph = make_symmetric_graph({left(), right()});
+      auto allgather = make_neighbor_allgather<int>(algorithm, group_all, graph, count);
+      ASSERT_EQ(allgather->getOutputCount(), 2 * count);
+
+      for (auto run = 0; run < 3; ++run)
+      {
+        auto const value = [run](auto r) { return static_cast<int>(10 * r.get() + run); };
+        std::vector<int> inputs(count, value(group_all.rank()));
+        std::vector<int> outputs(2 * count, -1);
+        std::vector<int> expected(count, value(left()));
+        expected.insert(expected.end(), count, value(right()));
+
+        allgather->start(inputs.data());
+        allgather->waitForCompletion(outputs.data());
+        ASSERT_EQ(outputs, expected);
+      }
+    }
+
+    // non-periodic chain with different counts on each edge
+    TEST_P(NeighborTest, alltoallv_chain)
+    {
+      // `a` sends `a + 2b + 1` elements with values `100a + b`
+      auto const count = [](std::size_t a, std::size_t b) { return a + 2 * b + 1; };
+      auto const value = [](std::size_t a, std::size_t b) { return static_cast<long>(100 * a + b); };
+
+      std::vector<gaspi::group::Rank> neighbors;
+      if (rank > 0) { neighbors.push_back(left()); }
+      if (rank + 1 < number_ranks) { neighbors.push_back(right()); }
+
+      std::vector<std::size_t> send_counts;
+      std::vector<std::size_t> recv_counts;
+      std::vector<long> inputs;
+      std::vector<long> expected;
+      for (auto const& neighbor : neighbors)
+      {
+        send_counts.push_back(count(rank, neighbor.get()));
+        recv_counts.push_back(count(neighbor.get(), rank));
+        inputs.insert(inputs.end(), send_counts.back(), value(rank, neighbor.get()));
+        expected.insert(expected.end(), recv_counts.back(), value(neighbor.get(), rank));
+      }
+
+      auto alltoallv = make_neighbor_alltoallv<long>(algorithm, group_all,
+                                                     make_symmetric_graph(neighbors),
+                                                     send_counts, recv_counts);
+      ASSERT_EQ(alltoallv->getOutputCount(), expected.size());
+      for (auto run = 0; run < 3; ++run)
+      {
+        std::vector<long> outputs(expected.size(), -1);
+        alltoallv->start(inputs.data());
+        alltoallv->waitForCompletion(outputs.data());
+        ASSERT_EQ(outputs, expected);
+      }
+    }
+
+    // directed ring, with sources and destinations differing
+    TEST_P(NeighborTest, alltoallv_directed_ring)
+    {
+      auto const count = 7UL;
+      NeighborGraph const graph{{left()}, {right()}};
+      auto alltoallv = make_neighbor_alltoallv<double>(algorithm, group_all, graph,
+                                                       {count}, {count});
+      for (auto run = 0; run < 3; ++run)
+      {
+        std::vector<double> inputs(count, rank + 0.5 * run);
+        std::vector<double> outputs(count, -1);
+        alltoallv->start(inputs.data());
+        alltoallv->waitForCompletion(outputs.data());
+        ASSERT_EQ(outputs, std::vector<double>(count, left().get() + 0.5 * run));
+      }
+    }
+
+    TEST_P(NeighborTest, invalid_graphs)
+    {
+      auto const graph = make_symmetric_graph({left()});
+      ASSERT_THROW(make_neighbor_alltoallv<int>(algorithm, group_all, graph, {1, 1}, {1}),
+                   std::logic_error);
+      ASSERT_THROW(make_neighbor_allgather<int>(algorithm, group_all,
+                                                make_symmetric_graph({gaspi::group::Rank(number_ranks)}), 1),
+                   std::logic_error);
+    }
+
+    INSTANTIATE_TEST_SUITE_P(Coll, NeighborTest,
+                             testing::ValuesIn(NeighborInfo::implemented));
+  }
+}
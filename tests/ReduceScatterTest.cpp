@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ReduceScatterTest.cpp
+ *
+ */
+
+#include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/collectives/non_blocking/ReduceScatter.hpp>
+#include <GaspiCxx/group/Group.hpp>
+
+#include "collectives_utilities.hpp"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace gaspi {
+  namespace collectives {
+
+    class ReduceScatterTest : public CollectivesFixture
+    {
+      protected:
+        // element `j` of block `i` on rank `r` is `r + i + j`
+        std::vector<int> make_inputs(std::vector<std::size_t> const& counts) const
+        {
+          std::vector<int> inputs;
+          for (auto i = 0UL; i < counts.size(); ++i)
+          {
+            for (auto j = 0UL; j < counts[i]; ++j)
+            {
+              inputs.push_back(group_all.rank().get() + i + j);
+            }
+          }
+          return inputs;
+        }
+
+        std::vector<int> make_expected_sum(std::vector<std::size_t> const& counts) const
+        {
+          auto const size = group_all.size();
+          auto const block = group_all.rank().get();
+          std::vector<int> expected(counts[block]);
+          for (auto j = 0UL; j < counts[block]; ++j)
+          {
+            expected[j] = size * (block + j) + size * (size - 1) / 2;
+          }
+          return expected;
+        }
+    };
+
+    TEST_F(ReduceScatterTest, equal_blocks)
+    {
+      auto const count = 7UL;
+      std::vector<std::size_t> const counts(group_all.size(), count);
+      ReduceScatter<int, ReduceScatterAlgorithm::RING> reduce_scatter(
+        group_all, count, ReductionOp::SUM);
+      ASSERT_EQ(reduce_scatter.getOutputCount(), count);
+      ASSERT_EQ(reduce_scatter.get_counts(), counts);
+
+      auto const inputs = make_inputs(counts);
+      auto const expected = make_expected_sum(counts);
+      for (auto run = 0; run < 3; ++run)
+      {
+        std::vector<int> outputs(count, 0);
+        reduce_scatter.start(inputs);
+        reduce_scatter.waitForCompletion(outputs);
+        ASSERT_EQ(outputs, expected);
+      }
+    }
+
+    TEST_F(ReduceScatterTest, various_counts)
+    {
+      // even ranks receive no elements, odd rank `i` receives `i + 1` elements
+      std::vector<std::size_t> counts(group_all.size(), 0);
+      for (auto i = 1UL; i < counts.size(); i += 2)
+      {
+        counts[i] = i + 1;
+      }
+      ReduceScatter<int, ReduceScatterAlgorithm::RING> reduce_scatter(
+        group_all, counts, ReductionOp::SUM);
+      ASSERT_EQ(reduce_scatter.getOutputCount(), counts[group_all.rank().get()]);
+
+      auto const inputs = make_inputs(counts);
+      auto const expected = make_expected_sum(counts);
+      std::vector<int> outputs(counts[group_all.rank().get()], 0);
+      reduce_scatter.start(inputs);
+      reduce_scatter.waitForCompletion(outputs);
+      ASSERT_EQ(outputs, expected);
+    }
+
+    TEST_F(ReduceScatterTest, max_reduction)
+    {
+      auto const count = 3UL;
+      ReduceScatter<double, ReduceScatterAlgorithm::RING> reduce_scatter(
+        group_all, count, ReductionOp::MAX);
+
+      std::vector<double> inputs(count * group_all.size(),
+                                 static_cast<double>(group_all.rank().get()));
+      std::vector<double> const expected(count, group_all.size() - 1.0);
+      std::vector<double> outputs(count);
+      reduce_scatter.start(inputs);
+      reduce_scatter.waitForCompletion(outputs);
+      ASSERT_EQ(outputs, expected);
+    }
+
+    TEST_F(ReduceScatterTest, empty_lowlevel)
+    {
+      std::vector<std::size_t> const counts(group_all.size(), 0);
+      ReduceScatterLowLevel<int, ReduceScatterAlgorithm::RING> reduce_scatter(
+        group_all, counts, ReductionOp::SUM);
+      std::vector<int> inputs;
+
+      reduce_scatter.waitForSetup();
+      reduce_scatter.copyIn(inputs.data());
+      reduce_scatter.start();
+      ASSERT_TRUE(reduce_scatter.waitForCompletion());
+      ASSERT_EQ(reduce_scatter.getOutputCount(), 0UL);
+    }
+
+    TEST_F(ReduceScatterTest, invalid_counts)
+    {
+      std::vector<std::size_t> const counts(group_all.size() + 1, 1);
+      ASSERT_THROW((ReduceScatterLowLevel<int, ReduceScatterAlgorithm::RING>(
+                     group_all, counts, ReductionOp::SUM)), std::logic_error);
+    }
+  }
+}
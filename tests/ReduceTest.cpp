@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ReduceTest.cpp
+ *
+ */
+
+#include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/collectives/non_blocking/Reduce.hpp>
+#include <GaspiCxx/group/Group.hpp>
+
+#include "collectives_utilities.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+namespace gaspi {
+  namespace collectives {
+
+    template<typename T>
+    std::unique_ptr<RootedReceiveCollective> make_reduce(ReduceAlgorithm algorithm,
+                                                         gaspi::group::Group const& group,
+                                                         std::size_t number_elements,
+                                                         gaspi::group::Rank const& root,
+                                                         ReductionOp reduction_op)
+    {
+      switch (algorithm)
+      {
+        case ReduceAlgorithm::BINOMIAL_TREE:
+        {
+          return std::make_unique<Reduce<T, ReduceAlgorithm::BINOMIAL_TREE>>(
+                   group, number_elements, root, reduction_op);
+        }
+        case ReduceAlgorithm::PIPELINED_CHAIN:
+        {
+          return std::make_unique<Reduce<T, ReduceAlgorithm::PIPELINED_CHAIN>>(
+                   group, number_elements, root, reduction_op);
+        }
+      }
+      return nullptr;
+    }
+
+    using ReduceTestCase = std::tuple<ReduceAlgorithm, std::size_t>;
+    class ReduceTest : public CollectivesFixture,
+                       public testing::WithParamInterface<ReduceTestCase>
+    {
+      protected:
+        ReduceTest()
+        : algorithm(std::get<0>(GetParam())),
+          num_elements(std::get<1>(GetParam()))
+        { }
+
+        ReduceAlgorithm algorithm;
+        std::size_t num_elements;
+    };
+
+    TEST_P(ReduceTest, sum_to_each_root)
+    {
+      auto const size = group_all.size();
+      auto const rank = group_all.rank();
+
+      // element `i` on rank `r` is `r + i`
+      std::vector<long> inputs(num_elements);
+      std::iota(inputs.begin(), inputs.end(), rank.get());
+      std::vector<long> expected(num_elements);
+      for (auto i = 0UL; i < num_elements; ++i)
+      {
+        expected[i] = size * i + size * (size - 1) / 2;
+      }
+
+      for (auto root = 0UL; root < size; ++root)
+      {
+        auto reduce = make_reduce<long>(algorithm, group_all, num_elements,
+                                        gaspi::group::Rank(root), ReductionOp::SUM);
+        for (auto run = 0; run < 2; ++run)
+        {
+          reduce->start(inputs.data());
+          if (rank == gaspi::group::Rank(root))
+          {
+            ASSERT_EQ(reduce->getOutputCount(), num_elements);
+            std::vector<long> outputs(num_elements, 0);
+            reduce->waitForCompletion(outputs.data());
+            ASSERT_EQ(outputs, expected);
+          }
+          else
+          {
+            ASSERT_EQ(reduce->getOutputCount(), 0UL);
+            reduce->waitForCompletion();
+          }
+        }
+        getRuntime().barrier();
+      }
+    }
+
+    TEST_P(ReduceTest, wrong_rank_calls)
+    {
+      gaspi::group::Rank const root(0);
+      auto reduce = make_reduce<int>(algorithm, group_all, num_elements,
+                                     root, ReductionOp::MAX);
+      std::vector<int> inputs(num_elements, group_all.rank().get());
+      std::vector<int> outputs(num_elements);
+
+      reduce->start(inputs.data());
+      if (group_all.rank() == root)
+      {
+        ASSERT_THROW(reduce->waitForCompletion(), std::logic_error);
+        reduce->waitForCompletion(outputs.data());
+        ASSERT_EQ(outputs, std::vector<int>(num_elements, group_all.size() - 1));
+      }
+      else
+      {
+        ASSERT_THROW(reduce->waitForCompletion(outputs.data()), std::logic_error);
+        reduce->waitForCompletion();
+      }
+    }
+
+    INSTANTIATE_TEST_SUITE_P(Coll, ReduceTest,
+                             testing::Combine(testing::ValuesIn(ReduceInfo::implemented),
+                                              testing::Values(0UL, 1UL, 5UL, 1003UL)));
+
+    class ReduceTestPipelinedChain : public CollectivesFixture
+    { };
+
+    // chunks of different sizes pipelined through the chain
+    TEST_F(ReduceTestPipelinedChain, multiple_chunks)
+    {
+      auto const num_elements = 100UL;
+      gaspi::group::Rank const root(group_all.size() - 1);
+      ReduceLowLevel<int, ReduceAlgorithm::PIPELINED_CHAIN> reduce(
+        group_all, num_elements, root, ReductionOp::SUM, 7 * sizeof(int));
+
+      std::vector<int> inputs(num_elements);
+      std::iota(inputs.begin(), inputs.end(), 0);
+      std::vector<int> expected(num_elements);
+      std::transform(inputs.begin(), inputs.end(), expected.begin(),
+                     [this](auto elem) { return elem * group_all.size(); });
+
+      reduce.waitForSetup();
+      for (auto run = 0; run < 3; ++run)
+      {
+        std::vector<int> outputs(num_elements, 0);
+        reduce.copyIn(inputs.data());
+        reduce.start();
+        reduce.waitForCompletion();
+        reduce.copyOut(group_all.rank() == root ? outputs.data() : CollectiveLowLevel::NO_DATA);
+        if (group_all.rank() == root)
+        {
+          ASSERT_EQ(outputs, expected);
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ReductionKernelsTest.cpp
+ *
+ */
+
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/ReductionKernels.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace gaspi {
+  namespace collectives {
+    namespace reduction {
+
+      template<typename T>
+      class ReductionKernelsTest : public ::testing::Test
+      {
+        protected:
+          // sizes that are not multiples of the SIMD width exercise the scalar remainder
+          std::vector<std::size_t> const sizes{0, 1, 7, 33, 1003};
+
+          template<typename Op, typename Reference>
+          void check_kernel(Reference reference)
+          {
+            for (auto const size : sizes)
+            {
+              std::vector<T> inouts(size);
+              std::vector<T> inputs(size);
+              std::vector<T> expected(size);
+              for (auto i = 0UL; i < size; ++i)
+              {
+                inouts[i] = static_cast<T>(i % 11);
+                inputs[i] = static_cast<T>(i % 5 + 2);
+                expected[i] = reference(inouts[i], inputs[i]);
+              }
+
+              reduce<T, Op>(inouts.data(), inputs.data(), size);
+              ASSERT_EQ(inouts, expected);
+            }
+          }
+      };
+
+      using ElementTypes = ::testing::Types<float, double, std::int16_t,
+                                            std::int32_t, std::int64_t>;
+      TYPED_TEST_SUITE(ReductionKernelsTest, ElementTypes);
+
+      TYPED_TEST(ReductionKernelsTest, sum)
+      {
+        using T = TypeParam;
+        this->template check_kernel<Sum>([](T a, T b) { return static_cast<T>(a + b); });
+      }
+
+      TYPED_TEST(ReductionKernelsTest, prod)
+      {
+        using T = TypeParam;
+        this->template check_kernel<Prod>([](T a, T b) { return static_cast<T>(a * b); });
+      }
+
+      TYPED_TEST(ReductionKernelsTest, min)
+      {
+        using T = TypeParam;
+        this->template check_kernel<Min>([](T a, T b) { return std::min(a, b); });
+      }
+
+      TYPED_TEST(ReductionKernelsTest, max)
+      {
+        using T = TypeParam;
+        this->template check_kernel<Max>([](T a, T b) { return std::max(a, b); });
+      }
+
+      TYPED_TEST(ReductionKernelsTest, logical)
+      {
+        using T = TypeParam;
+        this->template check_kernel<LogicalAnd>([](T a, T b) { return static_cast<T>(a != T(0) && b != T(0)); });
+        this->template check_kernel<LogicalOr>([](T a, T b) { return static_cast<T>(a != T(0) || b != T(0)); });
+      }
+
+      TYPED_TEST(ReductionKernelsTest, untyped_kernel)
+      {
+        using T = TypeParam;
+        std::vector<T> inouts(100, T(3));
+        std::vector<T> inputs(100, T(4));
+        std::vector<T> expected(100, T(7));
+
+        Kernel kernel = &reduce_untyped<T, Sum>;
+        kernel(inouts.data(), inputs.data(), inouts.size());
+        ASSERT_EQ(inouts, expected);
+      }
+
+      template<typename T>
+      class BitwiseReductionKernelsTest : public ReductionKernelsTest<T>
+      { };
+
+      using IntegralElementTypes = ::testing::Types<std::int16_t, std::int32_t, std::int64_t>;
+      TYPED_TEST_SUITE(BitwiseReductionKernelsTest, IntegralElementTypes);
+
+      TYPED_TEST(BitwiseReductionKernelsTest, bitwise)
+      {
+        using T = TypeParam;
+        this->template check_kernel<BitwiseAnd>([](T a, T b) { return static_cast<T>(a & b); });
+        this->template check_kernel<BitwiseOr>([](T a, T b) { return static_cast<T>(a | b); });
+        this->template check_kernel<BitwiseXor>([](T a, T b) { return static_cast<T>(a ^ b); });
+      }
+
+      TEST(ValueLocationReductionKernelsTest, min_max_location)
+      {
+        using T = ValueLocation<double>;
+        std::vector<T> const inputs {{1.0, 3}, {2.0, 3}, {5.0, 1}, {5.0, 0}};
+        std::vector<T> inouts_min {{2.0, 0}, {1.0, 0}, {5.0, 2}, {5.0, 1}};
+        std::vector<T> inouts_max(inouts_min);
+
+        std::vector<T> const expected_min {{1.0, 3}, {1.0, 0}, {5.0, 1}, {5.0, 0}};
+        std::vector<T> const expected_max {{2.0, 0}, {2.0, 3}, {5.0, 1}, {5.0, 0}};
+
+        reduce<T, MinLocation>(inouts_min.data(), inputs.data(), inputs.size());
+        reduce<T, MaxLocation>(inouts_max.data(), inputs.data(), inputs.size());
+        ASSERT_EQ(inouts_min, expected_min);
+        ASSERT_EQ(inouts_max, expected_max);
+      }
+
+      TEST(HalfPrecisionTest, float16_conversion)
+      {
+        ASSERT_EQ(static_cast<float>(float16(1.0f)), 1.0f);
+        ASSERT_EQ(static_cast<float>(float16(-2.5f)), -2.5f);
+        ASSERT_EQ(static_cast<float>(float16(65504.0f)), 65504.0f);
+        ASSERT_EQ(static_cast<float>(float16(0.0f)), 0.0f);
+        ASSERT_EQ(static_cast<float>(float16(std::ldexp(1.0f, -24))), std::ldexp(1.0f, -24));
+
+        // round to nearest even
+        ASSERT_EQ(static_cast<float>(float16(2049.0f)), 2048.0f);
+        ASSERT_EQ(static_cast<float>(float16(2051.0f)), 2052.0f);
+
+        ASSERT_TRUE(std::isinf(static_cast<float>(float16(1e6f))));
+        ASSERT_TRUE(std::isnan(static_cast<float>(float16(std::nanf("")))));
+      }
+
+      TEST(HalfPrecisionTest, bfloat16_conversion)
+      {
+        ASSERT_EQ(static_cast<float>(bfloat16(1.0f)), 1.0f);
+        ASSERT_EQ(static_cast<float>(bfloat16(-65536.0f)), -65536.0f);
+        ASSERT_NEAR(static_cast<float>(bfloat16(3.0e38f)), 3.0e38f, 3.0e38f / 256);
+
+        // round to nearest even
+        ASSERT_EQ(static_cast<float>(bfloat16(257.0f)), 256.0f);
+        ASSERT_EQ(static_cast<float>(bfloat16(259.0f)), 260.0f);
+
+        ASSERT_TRUE(std::isnan(static_cast<float>(bfloat16(std::nanf("")))));
+      }
+
+      template<typename T>
+      class HalfPrecisionReductionKernelsTest : public ::testing::Test
+      { };
+
+      using HalfPrecisionTypes = ::testing::Types<float16, bfloat16>;
+      TYPED_TEST_SUITE(HalfPrecisionReductionKernelsTest, HalfPrecisionTypes);
+
+      TYPED_TEST(HalfPrecisionReductionKernelsTest, accumulate_in_float)
+      {
+        using T = TypeParam;
+        auto const size = 1003UL;
+        std::vector<T> inouts(size, T(0.25f));
+        std::vector<T> inputs(size, T(0.5f));
+        std::vector<T> const expected_sum(size, T(0.75f));
+
+        auto kernel = get_kernel<T, Sum>();
+        ASSERT_TRUE(kernel);
+        kernel(inouts.data(), inputs.data(), size);
+        ASSERT_EQ(inouts, expected_sum);
+
+        reduce<T, Max>(inouts.data(), inputs.data(), size);
+        ASSERT_EQ(inouts, std::vector<T>(size, T(0.75f)));
+
+        std::vector<T> lower(size, T(0.25f));
+        reduce<T, Min>(lower.data(), inputs.data(), size);
+        ASSERT_EQ(lower, std::vector<T>(size, T(0.25f)));
+        ASSERT_FALSE((get_kernel<T, BitwiseAnd>()));
+      }
+    }
+  }
+}
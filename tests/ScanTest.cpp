@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ScanTest.cpp
+ *
+ */
+
+#include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/collectives/non_blocking/Scan.hpp>
+#include <GaspiCxx/group/Group.hpp>
+
+#include "collectives_utilities.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+namespace gaspi {
+  namespace collectives {
+
+    template<typename T>
+    std::unique_ptr<Collective> make_scan(ScanAlgorithm algorithm,
+                                          ScanType scan_type,
+                                          gaspi::group::Group const& group,
+                                          std::size_t number_elements,
+                                          ReductionOp reduction_op)
+    {
+      switch (algorithm)
+      {
+        case ScanAlgorithm::RECURSIVE_DOUBLING:
+        {
+          if (scan_type == ScanType::INCLUSIVE)
+          {
+            return std::make_unique<Scan<T, ScanAlgorithm::RECURSIVE_DOUBLING>>(
+                     group, number_elements, reduction_op);
+          }
+          return std::make_unique<Exscan<T, ScanAlgorithm::RECURSIVE_DOUBLING>>(
+                   group, number_elements, reduction_op);
+        }
+      }
+      return nullptr;
+    }
+
+    using ScanTestCase = std::tuple<ScanAlgorithm, std::size_t>;
+    class ScanTest : public CollectivesFixture,
+                     public testing::WithParamInterface<ScanTestCase>
+    {
+      protected:
+        ScanTest()
+        : algorithm(std::get<0>(GetParam())),
+          num_elements(std::get<1>(GetParam()))
+        { }
+
+        ScanAlgorithm algorithm;
+        std::size_t num_elements;
+    };
+
+    TEST_P(ScanTest, inclusive_sum)
+    {
+      auto const rank = group_all.rank().get();
+
+      // element `i` on rank `r` is `r + i`
+      std::vector<long> inputs(num_elements);
+      std::iota(inputs.begin(), inputs.end(), rank);
+      std::vector<long> expected(num_elements);
+      for (auto i = 0UL; i < num_elements; ++i)
+      {
+        expected[i] = (rank + 1) * i + rank * (rank + 1) / 2;
+      }
+
+      auto scan = make_scan<long>(algorithm, ScanType::INCLUSIVE, group_all,
+                                  num_elements, ReductionOp::SUM);
+      ASSERT_EQ(scan->getOutputCount(), num_elements);
+      for (auto run = 0; run < 3; ++run)
+      {
+        std::vector<long> outputs(num_elements, 0);
+        scan->start(inputs.data());
+        scan->waitForCompletion(outputs.data());
+        ASSERT_EQ(outputs, expected);
+      }
+    }
+
+    TEST_P(ScanTest, exclusive_sum)
+    {
+      auto const rank = group_all.rank().get();
+
+      std::vector<long> inputs(num_elements);
+      std::iota(inputs.begin(), inputs.end(), rank);
+      std::vector<long> expected(num_elements);
+      for (auto i = 0UL; i < num_elements; ++i)
+      {
+        expected[i] = rank * i + rank * (rank - 1) / 2;
+      }
+
+      auto exscan = make_scan<long>(algorithm, ScanType::EXCLUSIVE, group_all,
+                                    num_elements, ReductionOp::SUM);
+      ASSERT_EQ(exscan->getOutputCount(), rank == 0 ? 0UL : num_elements);
+      for (auto run = 0; run < 3; ++run)
+      {
+        std::vector<long> outputs(exscan->getOutputCount(), 0);
+        exscan->start(inputs.data());
+        exscan->waitForCompletion(outputs.data());
+        if (rank != 0)
+        {
+          ASSERT_EQ(outputs, expected);
+        }
+      }
+    }
+
+    // a non-monotonic operation detects contributions in the wrong order
+    // or from the wrong ranks
+    TEST_P(ScanTest, inclusive_max_exclusive_min)
+    {
+      auto const size = group_all.size();
+      auto const rank = group_all.rank().get();
+
+      // rank `r` contributes `(r * 7) % size`
+      auto const value = [size](std::size_t r) { return static_cast<int>((r * 7) % size); };
+      std::vector<int> inputs(num_elements, value(rank));
+      auto max_value = value(0);
+      auto min_value = value(0);
+      for (auto r = 1UL; r <= rank; ++r)
+      {
+        max_value = std::max(max_value, value(r));
+        if (r < rank) { min_value = std::min(min_value, value(r)); }
+      }
+
+      auto scan = make_scan<int>(algorithm, ScanType::INCLUSIVE, group_all,
+                                 num_elements, ReductionOp::MAX);
+      auto exscan = make_scan<int>(algorithm, ScanType::EXCLUSIVE, group_all,
+                                   num_elements, ReductionOp::MIN);
+      std::vector<int> max_outputs(num_elements);
+      std::vector<int> min_outputs(exscan->getOutputCount());
+
+      scan->start(inputs.data());
+      exscan->start(inputs.data());
+      scan->waitForCompletion(max_outputs.data());
+      exscan->waitForCompletion(min_outputs.data());
+
+      ASSERT_EQ(max_outputs, std::vector<int>(num_elements, max_value));
+      if (rank != 0)
+      {
+        ASSERT_EQ(min_outputs, std::vector<int>(num_elements, min_value));
+      }
+    }
+
+    INSTANTIATE_TEST_SUITE_P(Coll, ScanTest,
+                             testing::Combine(testing::ValuesIn(ScanInfo::implemented),
+                                              testing::Values(0UL, 1UL, 5UL, 1003UL)));
+  }
+}
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ScattervTest.cpp
+ *
+ */
+
+#include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/collectives/non_blocking/Scatterv.hpp>
+#include <GaspiCxx/group/Group.hpp>
+
+#include "collectives_utilities.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+namespace gaspi {
+  namespace collectives {
+
+    template<typename T>
+    std::unique_ptr<RootedSendCollective> make_scatterv(ScattervAlgorithm algorithm,
+                                                        gaspi::group::Group const& group,
+                                                        std::vector<std::size_t> const& counts,
+                                                        gaspi::group::Rank const& root)
+    {
+      switch (algorithm)
+      {
+        case ScattervAlgorithm::BINOMIAL_TREE:
+        {
+          return std::make_unique<Scatterv<T, ScattervAlgorithm::BINOMIAL_TREE>>(
+                   group, counts, root);
+        }
+        case ScattervAlgorithm::DIRECT:
+        {
+          return std::make_unique<Scatterv<T, ScattervAlgorithm::DIRECT>>(
+                   group, counts, root);
+        }
+      }
+      return nullptr;
+    }
+
+    // the inputs of the root are consecutive numbers starting at `first`,
+    // such that rank `r` receives `offsets[r] + first, ...`
+    std::vector<int> get_scatter_expected(std::vector<std::size_t> const& counts,
+                                          gaspi::group::Rank const& rank, int first)
+    {
+      auto const offset = std::accumulate(counts.begin(), counts.begin() + rank.get(), 0UL);
+      std::vector<int> expected(counts[rank.get()]);
+      std::iota(expected.begin(), expected.end(), first + static_cast<int>(offset));
+      return expected;
+    }
+
+    using ScattervTestCase = std::tuple<ScattervAlgorithm, std::size_t>;
+    class ScattervTest : public CollectivesFixture,
+                         public testing::WithParamInterface<ScattervTestCase>
+    {
+      protected:
+        ScattervTest()
+        : algorithm(std::get<0>(GetParam())),
+          num_elements(std::get<1>(GetParam()))
+        { }
+
+        void scatter_from_each_root(std::vector<std::size_t> const& counts)
+        {
+          auto const rank = group_all.rank();
+          auto const total = std::accumulate(counts.begin(), counts.end(), 0UL);
+
+          for (auto root = 0UL; root < group_all.size(); ++root)
+          {
+            auto scatterv = make_scatterv<int>(algorithm, group_all, counts,
+                                               gaspi::group::Rank(root));
+            ASSERT_EQ(scatterv->getOutputCount(), counts[rank.get()]);
+            for (auto run = 0; run < 2; ++run)
+            {
+              auto const first = 100 * run;
+              if (rank == gaspi::group::Rank(root))
+              {
+                std::vector<int> inputs(total);
+                std::iota(inputs.begin(), inputs.end(), first);
+                scatterv->start(inputs.data());
+              }
+              else
+              {
+                scatterv->start();
+              }
+
+              std::vector<int> outputs(counts[rank.get()], -1);
+              scatterv->waitForCompletion(outputs.data());
+              ASSERT_EQ(outputs, get_scatter_expected(counts, rank, first));
+            }
+            getRuntime().barrier();
+          }
+        }
+
+        ScattervAlgorithm algorithm;
+        std::size_t num_elements;
+    };
+
+    TEST_P(ScattervTest, same_counts)
+    {
+      scatter_from_each_root(std::vector<std::size_t>(group_all.size(), num_elements));
+    }
+
+    // rank `r` receives `(r % 3) * num_elements` elements
+    TEST_P(ScattervTest, various_counts)
+    {
+      std::vector<std::size_t> counts(group_all.size());
+      for (auto i = 0UL; i < counts.size(); ++i)
+      {
+        counts[i] = (i % 3) * num_elements;
+      }
+      scatter_from_each_root(counts);
+    }
+
+    TEST_P(ScattervTest, wrong_rank_calls)
+    {
+      gaspi::group::Rank const root(0);
+      std::vector<std::size_t> const counts(group_all.size(), num_elements);
+      auto scatterv = make_scatterv<int>(algorithm, group_all, counts, root);
+      std::vector<int> inputs(num_elements * group_all.size());
+      std::iota(inputs.begin(), inputs.end(), 0);
+      std::vector<int> outputs(num_elements);
+
+      if (group_all.rank() == root)
+      {
+        ASSERT_THROW(scatterv->start(), std::logic_error);
+        scatterv->start(inputs.data());
+      }
+      else
+      {
+        ASSERT_THROW(scatterv->start(inputs.data()), std::logic_error);
+        scatterv->start();
+      }
+      scatterv->waitForCompletion(outputs.data());
+      ASSERT_EQ(outputs, get_scatter_expected(counts, group_all.rank(), 0));
+    }
+
+    INSTANTIATE_TEST_SUITE_P(Coll, ScattervTest,
+                             testing::Combine(testing::ValuesIn(ScattervInfo::implemented),
+                                              testing::Values(0UL, 1UL, 5UL, 1003UL)));
+
+    class ScattervTestHighLevel : public CollectivesFixture
+    { };
+
+    TEST_F(ScattervTestHighLevel, scatter_vectors)
+    {
+      auto const count = 4UL;
+      gaspi::group::Rank const root(group_all.size() - 1);
+      Scatter<int, ScattervAlgorithm::BINOMIAL_TREE> scatter(group_all, count, root);
+      std::vector<std::size_t> const counts(group_all.size(), count);
+      ASSERT_EQ(scatter.get_counts(), counts);
+
+      if (group_all.rank() == root)
+      {
+        std::vector<int> inputs(count * group_all.size());
+        std::iota(inputs.begin(), inputs.end(), 0);
+        scatter.start(inputs);
+      }
+      else
+      {
+        scatter.start();
+      }
+      std::vector<int> outputs(scatter.getOutputCount());
+      scatter.waitForCompletion(outputs);
+      ASSERT_EQ(outputs, get_scatter_expected(counts, group_all.rank(), 0));
+    }
+
+    // counts exchanged at construction
+    TEST_F(ScattervTestHighLevel, scatterv_exchanged_counts)
+    {
+      auto const count = group_all.rank().get() + 1;
+      gaspi::group::Rank const root(0);
+      Scatterv<int, ScattervAlgorithm::DIRECT> scatterv(group_all, count, root);
+      std::vector<std::size_t> counts(group_all.size());
+      std::iota(counts.begin(), counts.end(), 1UL);
+      ASSERT_EQ(scatterv.get_counts(), counts);
+
+      if (group_all.rank() == root)
+      {
+        std::vector<int> inputs(std::accumulate(counts.begin(), counts.end(), 0UL));
+        std::iota(inputs.begin(), inputs.end(), 0);
+        scatterv.start(inputs);
+      }
+      else
+      {
+        scatterv.start();
+      }
+      std::vector<int> outputs(scatterv.getOutputCount());
+      scatterv.waitForCompletion(outputs);
+      ASSERT_EQ(outputs, get_scatter_expected(counts, group_all.rank(), 0));
+    }
+  }
+}
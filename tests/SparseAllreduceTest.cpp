@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * SparseAllreduceTest.cpp
+ *
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/collectives/non_blocking/SparseAllreduce.hpp>
+#include <GaspiCxx/group/Group.hpp>
+
+#include "collectives_utilities.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace gaspi {
+  namespace collectives {
+
+    class SparseAllreduceTest : public CollectivesFixture
+    {
+      protected:
+        using ElemType = float;
+        using Vector = SparseVector<ElemType>;
+
+        SparseAllreduceTest()
+        : rank(group_all.rank().get()),
+          size(group_all.size())
+        { }
+
+        std::vector<ElemType> to_dense(Vector const& vector, std::size_t number_elements)
+        {
+          std::vector<ElemType> dense(number_elements, 0);
+          for (auto i = 0UL; i < vector.indices.size(); ++i)
+          {
+            dense[vector.indices[i]] += vector.values[i];
+          }
+          return dense;
+        }
+
+        void check_result(Vector const& result, std::vector<ElemType> const& expected)
+        {
+          ASSERT_EQ(result.indices.size(), result.values.size());
+          ASSERT_TRUE(std::is_sorted(result.indices.begin(), result.indices.end()));
+          ASSERT_EQ(std::adjacent_find(result.indices.begin(), result.indices.end()),
+                    result.indices.end());
+          ASSERT_EQ(to_dense(result, expected.size()), expected);
+        }
+
+        std::size_t const rank;
+        std::size_t const size;
+    };
+
+    TEST_F(SparseAllreduceTest, disjoint_entries)
+    {
+      auto const num_elements = 10000UL;
+      auto const num_entries = 20UL;
+
+      Vector inputs;
+      std::vector<ElemType> expected(num_elements, 0);
+      for (auto i = 0UL; i < num_entries; ++i)
+      {
+        inputs.indices.push_back(rank + i * size);
+        inputs.values.push_back(static_cast<ElemType>(rank + 1));
+        for (auto r = 0UL; r < size; ++r)
+        {
+          expected[r + i * size] = static_cast<ElemType>(r + 1);
+        }
+      }
+
+      SparseAllreduce<ElemType> allreduce(group_all, num_elements, ReductionOp::SUM);
+      for (auto run = 0; run < 3; ++run)
+      {
+        Vector outputs;
+        allreduce.start(inputs);
+        allreduce.waitForCompletion(outputs);
+
+        ASSERT_EQ(allreduce.getOutputCount(), num_entries * size);
+        check_result(outputs, expected);
+      }
+    }
+
+    TEST_F(SparseAllreduceTest, unsorted_repeated_entries)
+    {
+      auto const num_elements = 1000UL;
+      SparseAllreduce<ElemType> allreduce(group_all, num_elements, ReductionOp::SUM);
+
+      for (auto run = 0UL; run < 3; ++run)
+      {
+        auto const value = static_cast<ElemType>(run + 1);
+        Vector inputs{{7, 3, 7, static_cast<Vector::Index>(100 + rank)},
+                      {value, 2, value, 1}};
+        std::vector<ElemType> expected(num_elements, 0);
+        expected[3] = 2.0f * size;
+        expected[7] = 2.0f * value * size;
+        for (auto r = 0UL; r < size; ++r)
+        {
+          expected[100 + r] = 1;
+        }
+
+        Vector outputs;
+        allreduce.start(inputs);
+        allreduce.waitForCompletion(outputs);
+
+        ASSERT_EQ(allreduce.getOutputCount(), 2 + size);
+        check_result(outputs, expected);
+      }
+    }
+
+    TEST_F(SparseAllreduceTest, dense_representation)
+    {
+      auto const num_elements = 100UL;
+      auto const num_entries = 10UL;
+      auto const density_threshold = 0.05;
+
+      Vector inputs;
+      std::vector<ElemType> expected(num_elements, 0);
+      for (auto i = 0UL; i < num_entries; ++i)
+      {
+        inputs.indices.push_back((rank * num_entries + i) % num_elements);
+        inputs.values.push_back(1);
+        for (auto r = 0UL; r < size; ++r)
+        {
+          expected[(r * num_entries + i) % num_elements] += 1;
+        }
+      }
+
+      SparseAllreduce<ElemType> allreduce(group_all, num_elements, ReductionOp::SUM,
+                                          density_threshold);
+      for (auto run = 0; run < 2; ++run)
+      {
+        Vector outputs;
+        allreduce.start(inputs);
+        allreduce.waitForCompletion(outputs);
+
+        // all elements are returned for dense results
+        ASSERT_EQ(outputs.indices.size(), num_elements);
+        check_result(outputs, expected);
+      }
+    }
+
+    TEST_F(SparseAllreduceTest, empty_inputs)
+    {
+      auto const num_elements = 1000UL;
+      SparseAllreduce<ElemType> allreduce(group_all, num_elements, ReductionOp::SUM);
+
+      Vector outputs{{1}, {1}};
+      allreduce.start(Vector{});
+      allreduce.waitForCompletion(outputs);
+
+      ASSERT_TRUE(outputs.indices.empty());
+      ASSERT_TRUE(outputs.values.empty());
+    }
+
+    TEST_F(SparseAllreduceTest, invalid_inputs)
+    {
+      auto const num_elements = 10UL;
+      SparseAllreduce<ElemType> allreduce(group_all, num_elements, ReductionOp::SUM);
+
+      ASSERT_THROW(allreduce.start(Vector{{1, 2}, {1}}), std::logic_error);
+      ASSERT_THROW(allreduce.start(Vector{{10}, {1}}), std::logic_error);
+    }
+  }
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Fraunhofer ITWM - <http://www.itwm.fraunhofer.de/>, 2019 - 2021
+ *
+ * This file is part of GaspiCxx.
+ *
+ * GaspiCxx is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 3 as published by the Free Software Foundation.
+ *
+ * GaspiCxx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GaspiCxx. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * TuningTest.cpp
+ *
+ */
+
+#include <GaspiCxx/Runtime.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllgathervCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/AllreduceAuto.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/BroadcastCommon.hpp>
+#include <GaspiCxx/collectives/non_blocking/collectives_lowlevel/Tuning.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace gaspi {
+  namespace collectives {
+
+    namespace
+    {
+      auto const unbounded = SelectionRule::unbounded;
+    }
+
+    TEST(TuningTest, parse_tables)
+    {
+      auto const tables = parse_tuning_tables("# tuned on 2 nodes\n"
+                                              "allreduce 4:16384:recursivedoubling, *:*:ring\n"
+                                              "\n"
+                                              "broadcast *:*:sendtoall # single rule\n");
+      TuningTables const expected
+        { {"allreduce", {{4, 16384, "recursivedoubling"}, {unbounded, unbounded, "ring"}}},
+          {"broadcast", {{unbounded, unbounded, "sendtoall"}}} };
+      ASSERT_EQ(tables, expected);
+      ASSERT_EQ(parse_tuning_tables(to_string(tables)), tables);
+      ASSERT_TRUE(parse_tuning_tables("# no tables").empty());
+    }
+
+    TEST(TuningTest, invalid_tables)
+    {
+      ASSERT_THROW(parse_tuning_tables("allreduce\n"), std::logic_error);
+      ASSERT_THROW(parse_tuning_tables("allreduce *:ring\n"), std::logic_error);
+      ASSERT_THROW(parse_tuning_tables("allreduce *:*:ring\nallreduce *:*:rd\n"),
+                   std::logic_error);
+      ASSERT_THROW(read_tuning_file("non-existing-tuning-file.txt"), std::logic_error);
+    }
+
+    TEST(TuningTest, build_table_from_measurements)
+    {
+      std::vector<TuningMeasurement> const measurements
+        { {2, 16, "a", 1.0}, {2, 16, "b", 2.0},
+          {2, 64, "a", 1.0}, {2, 64, "b", 2.0},
+          {2, 256, "a", 3.0}, {2, 256, "b", 2.0},
+          {4, 16, "a", 1.0}, {4, 16, "b", 2.0},
+          {4, 64, "a", 3.0}, {4, 64, "b", 2.0},
+          {4, 256, "a", 3.0}, {4, 256, "b", 2.0},
+          {8, 16, "a", 1.0}, {8, 16, "b", 2.0},
+          {8, 64, "a", 3.0}, {8, 64, "b", 2.0},
+          {8, 256, "b", 2.0}, {8, 256, "a", 3.0} };
+
+      // group sizes 4 and 8 share their rules
+      SelectionTable const expected
+        { {2, 64, "a"}, {2, unbounded, "b"},
+          {unbounded, 16, "a"}, {unbounded, unbounded, "b"} };
+      ASSERT_EQ(build_selection_table(measurements), expected);
+      ASSERT_TRUE(build_selection_table({}).empty());
+    }
+
+    TEST(TuningTest, auto_allreduce_tuning_file)
+    {
+      auto const tuning_file = "gaspicxx-tuning-test-" +
+                               std::to_string(getRuntime().global_rank()) + ".txt";
+      write_tuning_file(tuning_file, {{"allreduce", {{unbounded, unbounded, "rabenseifner"}}},
+                                      {"broadcast", {{unbounded, 64, "linear"}}}});
+      Runtime::configuration.set_tuning_file(tuning_file);
+
+      ASSERT_EQ(get_tuning_file(), tuning_file);
+      ASSERT_EQ(select_allreduce_algorithm(4, 100), AllreduceAlgorithm::RABENSEIFNER);
+      ASSERT_EQ(select_tuned_algorithm<BroadcastInfo>("broadcast", 4, 64,
+                                                      BroadcastAlgorithm::SEND_TO_ALL),
+                BroadcastAlgorithm::BASIC_LINEAR);
+      ASSERT_EQ(select_tuned_algorithm<BroadcastInfo>("broadcast", 4, 65,
+                                                      BroadcastAlgorithm::SEND_TO_ALL),
+                BroadcastAlgorithm::SEND_TO_ALL);
+      ASSERT_EQ(select_tuned_algorithm<AllgathervInfo>("allgatherv", 4, 64,
+                                                       AllgathervAlgorithm::RING),
+                AllgathervAlgorithm::RING);
+
+      // explicit selection rules take precedence over the tuning file
+      Runtime::configuration.set_allreduce_selection("*:*:ring");
+      ASSERT_EQ(select_allreduce_algorithm(4, 100), AllreduceAlgorithm::RING);
+      Runtime::configuration.set_allreduce_selection("");
+
+      group::Group const group_all;
+      AllreduceLowLevel<int, AllreduceAlgorithm::AUTO> allreduce(
+        group_all, 10, ReductionOp::SUM);
+      ASSERT_EQ(allreduce.getSelectedAlgorithm(), AllreduceAlgorithm::RABENSEIFNER);
+      allreduce.waitForSetup();
+
+      Runtime::configuration.set_tuning_file("");
+      std::remove(tuning_file.c_str());
+      getRuntime().barrier();
+    }
+  }
+}
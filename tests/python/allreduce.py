@@ -52,7 +52,7 @@ class TestAllreduce:
 
   @pytest.mark.parametrize("list_length", [0, 1001])
   @pytest.mark.parametrize("dtype", ["int", "double"])
-  @pytest.mark.parametrize("algorithm", ["ring", "recursivedoubling"])
+  @pytest.mark.parametrize("algorithm", ["ring", "recursivedoubling", "rabenseifner", "hierarchical", "auto"])
   def test_algorithms(self, list_length, dtype, algorithm):
     input_list = [ pygpi.get_size() ] * list_length
     expected_output = [elem * pygpi.get_size() for elem in input_list]
@@ -62,3 +62,19 @@ class TestAllreduce:
     allreduce.start(input_list)
     output_array = allreduce.wait_for_completion()
     assert np.array_equal(output_array, expected_output)
+
+  @pytest.mark.parametrize("op, make_input, expected", [
+                           ("MIN", lambda rank: rank, lambda size: 0),
+                           ("MAX", lambda rank: rank, lambda size: size - 1),
+                           ("BOR", lambda rank: 1 << rank, lambda size: (1 << size) - 1),
+                           ("LOR", lambda rank: int(rank == 0), lambda size: 1),
+                           ("LAND", lambda rank: int(rank == 0), lambda size: int(size == 1))])
+  def test_reduction_ops(self, op, make_input, expected):
+    input_array = np.empty(shape=(10), dtype=np.int32)
+    input_array.fill(make_input(pygpi.get_rank()))
+
+    allreduce = pygpi.Allreduce(pygpi.Group(), input_array.size,
+                                getattr(pygpi.ReductionOp, op), dtype = np.int32)
+    allreduce.start(input_array)
+    output_array = allreduce.wait_for_completion()
+    assert np.all(output_array == expected(pygpi.get_size()))
@@ -52,7 +52,8 @@ class TestBroadcast:
 
   @pytest.mark.parametrize("list_length", [0, 1001])
   @pytest.mark.parametrize("dtype", ["int", "long"])
-  @pytest.mark.parametrize("algorithm", ["linear", "sendtoall"])
+  @pytest.mark.parametrize("algorithm", ["linear", "sendtoall", "binomialtree", "pipelinedchain",
+                                         "scatterallgather"])
   def test_algorithms(self, list_length, dtype, algorithm):
     root = 0
     input_list = [ pygpi.get_size() ] * list_length